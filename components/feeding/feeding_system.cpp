@@ -1,9 +1,21 @@
 #include "feeding_system.h"
 
-bool save_feeding_data() {
-    return false;
+static PodSection<FeedingState> section(PERSIST_SECTION_FEEDING, "feeding");
+
+const FeedingState& feeding_state() {
+    return section.get();
+}
+
+void feeding_record_meal(uint32_t timestamp_ms, bool accepted) {
+    FeedingState& state = section.edit();
+    if (accepted) {
+        state.total_meals++;
+        state.last_meal_ms = timestamp_ms;
+    } else {
+        state.refused_meals++;
+    }
 }
 
-bool load_feeding_data() {
-    return false;
+PersistentSection& feeding_persistence() {
+    return section;
 }
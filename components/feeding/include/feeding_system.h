@@ -1,5 +1,19 @@
 #pragma once
 
-// Minimal interface for the feeding system
-bool save_feeding_data();
-bool load_feeding_data();
+#include "persistence.h"
+#include <stdint.h>
+
+// Persistent state of the feeding system, stored as its own save section
+struct FeedingState {
+    uint32_t total_meals;   // Meals accepted
+    uint32_t refused_meals; // Inappropriate food offered
+    uint32_t last_meal_ms;  // Game time of the last accepted meal
+    uint32_t reserved;
+};
+
+const FeedingState& feeding_state();
+void feeding_record_meal(uint32_t timestamp_ms, bool accepted);
+
+// Section registered with the save system; changes are written with the
+// next batched save
+PersistentSection& feeding_persistence();
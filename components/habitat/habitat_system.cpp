@@ -1,9 +1,21 @@
 #include "habitat_system.h"
 
-bool save_habitat_data() {
-    return false;
+static PodSection<HabitatState> section(PERSIST_SECTION_HABITAT, "habitat");
+
+const HabitatState& habitat_state() {
+    return section.get();
+}
+
+void habitat_record_cleaning(uint32_t timestamp_ms) {
+    HabitatState& state = section.edit();
+    state.cleanings++;
+    state.last_cleaning_ms = timestamp_ms;
+}
+
+void habitat_record_adjustment() {
+    section.edit().adjustments++;
 }
 
-bool load_habitat_data() {
-    return false;
+PersistentSection& habitat_persistence() {
+    return section;
 }
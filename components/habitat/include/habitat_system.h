@@ -1,5 +1,20 @@
 #pragma once
 
-// Minimal interface for the habitat system
-bool save_habitat_data();
-bool load_habitat_data();
+#include "persistence.h"
+#include <stdint.h>
+
+// Persistent state of the habitat system, stored as its own save section
+struct HabitatState {
+    uint32_t cleanings;        // Terrarium cleanings
+    uint32_t adjustments;      // Temperature, humidity and lighting changes
+    uint32_t last_cleaning_ms; // Game time of the last cleaning
+    uint32_t reserved;
+};
+
+const HabitatState& habitat_state();
+void habitat_record_cleaning(uint32_t timestamp_ms);
+void habitat_record_adjustment();
+
+// Section registered with the save system; changes are written with the
+// next batched save
+PersistentSection& habitat_persistence();
@@ -1,9 +1,21 @@
 #include "health_system.h"
 
-bool save_health_data() {
-    return false;
+static PodSection<HealthState> section(PERSIST_SECTION_HEALTH, "health");
+
+const HealthState& health_state() {
+    return section.get();
+}
+
+void health_record_diagnosis() {
+    section.edit().diagnoses++;
+}
+
+void health_record_treatment(uint32_t timestamp_ms) {
+    HealthState& state = section.edit();
+    state.treatments++;
+    state.last_treatment_ms = timestamp_ms;
 }
 
-bool load_health_data() {
-    return false;
+PersistentSection& health_persistence() {
+    return section;
 }
@@ -1,5 +1,20 @@
 #pragma once
 
-// Minimal interface for the health system
-bool save_health_data();
-bool load_health_data();
+#include "persistence.h"
+#include <stdint.h>
+
+// Persistent state of the health system, stored as its own save section
+struct HealthState {
+    uint32_t diagnoses;         // Health checks performed
+    uint32_t treatments;        // Treatments given
+    uint32_t last_treatment_ms; // Game time of the last treatment
+    uint32_t reserved;
+};
+
+const HealthState& health_state();
+void health_record_diagnosis();
+void health_record_treatment(uint32_t timestamp_ms);
+
+// Section registered with the save system; changes are written with the
+// next batched save
+PersistentSection& health_persistence();
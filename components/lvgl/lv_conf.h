@@ -5,7 +5,8 @@
    GENERAL SETTINGS
  *====================*/
 
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CLIB
+/* Allocateur C compté (lv_mem_esp.c) : lv_mem_monitor() donne les octets tenus par LVGL */
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM
 #define LV_USE_STDLIB_STRING    LV_STDLIB_CLIB
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_CLIB
 
@@ -23,11 +24,7 @@
 /*====================
    HAL SETTINGS
  *====================*/
-#define LV_TICK_CUSTOM 1
-#if LV_TICK_CUSTOM
-    #define LV_TICK_CUSTOM_INCLUDE "esp_timer.h"
-    #define LV_TICK_CUSTOM_SYS_TIME_EXPR (esp_timer_get_time() / 1000)
-#endif
+/* LVGL 9 : l'horloge est fournie par lv_tick_set_cb() (DisplayDriver::initialize) */
 
 #define LV_DPI_DEF 130
 
@@ -35,6 +32,14 @@
  * FEATURE USAGE
  *==================*/
 #define LV_USE_DRAW_SW 1
+/* Remplissages et mélanges RGB565 vectoriels (composant rgb565) */
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE "lv_blend_rgb565.h"
+/* Rendu parallèle : une unité de dessin par thread, un thread par cœur
+   (lv_os_esp.c). 1 pour comparer le temps de rendu par image */
+#define LV_USE_OS LV_OS_CUSTOM
+#define LV_OS_CUSTOM_INCLUDE "lv_os_esp.h"
+#define LV_DRAW_SW_DRAW_UNIT_CNT 2
 #define LV_USE_DRAW_VGLITE 0
 #define LV_USE_DRAW_SDL 0
 
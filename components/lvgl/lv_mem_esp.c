@@ -0,0 +1,85 @@
+#include "lvgl.h"
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+#include "esp_heap_caps.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Allocateur C de LVGL, compté : lv_mem_monitor() isole les octets tenus
+// par LVGL du reste du tas (tâches de sauvegarde, I2C, tactile), ce qui
+// donne l'empreinte d'un écran au ScreenCache. Taille réelle des blocs
+// relue par heap_caps_get_allocated_size, sans en-tête ajouté. Les threads
+// de dessin allouent aussi : compteurs atomiques.
+static atomic_size_t used_bytes;
+static atomic_size_t peak_bytes;
+static atomic_uint_fast32_t used_blocks;
+
+static void account(size_t added, size_t removed) {
+    size_t used = atomic_fetch_add(&used_bytes, added) + added;
+    atomic_fetch_sub(&used_bytes, removed);
+    used -= removed;
+    size_t peak = atomic_load(&peak_bytes);
+    while (used > peak && !atomic_compare_exchange_weak(&peak_bytes, &peak, used)) {
+    }
+}
+
+void lv_mem_init(void) {
+}
+
+void lv_mem_deinit(void) {
+}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    LV_UNUSED(pool);
+}
+
+void* lv_malloc_core(size_t size) {
+    void* p = malloc(size);
+    if (p) {
+        atomic_fetch_add(&used_blocks, 1);
+        account(heap_caps_get_allocated_size(p), 0);
+    }
+    return p;
+}
+
+void* lv_realloc_core(void* p, size_t new_size) {
+    size_t old_size = p ? heap_caps_get_allocated_size(p) : 0;
+    void* q = realloc(p, new_size);
+    if (!q) return NULL;
+    if (!p) atomic_fetch_add(&used_blocks, 1);
+    account(heap_caps_get_allocated_size(q), old_size);
+    return q;
+}
+
+void lv_free_core(void* p) {
+    if (!p) return;
+    atomic_fetch_sub(&used_blocks, 1);
+    account(0, heap_caps_get_allocated_size(p));
+    free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) {
+    // total - free = octets tenus par LVGL
+    size_t used = atomic_load(&used_bytes);
+    size_t free_size = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    mon_p->total_size = used + free_size;
+    mon_p->free_size = free_size;
+    mon_p->free_biggest_size = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    mon_p->used_cnt = atomic_load(&used_blocks);
+    mon_p->max_used = atomic_load(&peak_bytes);
+    mon_p->used_pct = (uint8_t)(mon_p->total_size ? used * 100 / mon_p->total_size : 0);
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return heap_caps_check_integrity_all(true) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include "lvgl.h"
+
+#if LV_USE_OS == LV_OS_CUSTOM
+
+#if LVGL_VERSION_MAJOR != 9 || LVGL_VERSION_MINOR != 2
+#error "lv_os_esp.c suit l'API de LVGL 9.2 (lvgl_version.cmake)"
+#endif
+
+#include "esp_log.h"
+
+static const char* TAG = "LvOs";
+
+static const BaseType_t thread_cores[] = LV_OS_ESP_THREAD_CORES;
+static uint32_t thread_count = 0;
+
+static void thread_entry(void* arg) {
+    lv_thread_t* thread = (lv_thread_t*)arg;
+    thread->callback(thread->user_data);
+    // Fin du thread (lv_deinit) : lv_thread_delete() supprime la tâche
+    while (1) vTaskSuspend(NULL);
+}
+
+lv_result_t lv_thread_init(lv_thread_t* thread, const char* const name, lv_thread_prio_t prio,
+                           void (*callback)(void*), size_t stack_size, void* user_data) {
+    BaseType_t core = thread_cores[thread_count % (sizeof(thread_cores) / sizeof(thread_cores[0]))];
+    UBaseType_t priority = tskIDLE_PRIORITY + prio;
+    if (core == 0 && priority > LV_OS_ESP_CORE0_MAX_PRIO) priority = LV_OS_ESP_CORE0_MAX_PRIO;
+    thread->callback = callback;
+    thread->user_data = user_data;
+    thread->task = NULL;
+    // Même échelle que le portage FreeRTOS de LVGL : LV_THREAD_PRIO_HIGH (dessin) = 3,
+    // au-dessus du moteur de jeu (2) et de la tâche UI (1), sous le tactile et l'I2C.
+    // Sur le cœur 0, plafonné sous la copie LcdFlush pour qu'elle ne soit pas découpée
+    if (xTaskCreatePinnedToCore(thread_entry, name, stack_size, thread, priority, &thread->task, core) != pdPASS) {
+        ESP_LOGE(TAG, "Thread LVGL %s impossible", name);
+        return LV_RESULT_INVALID;
+    }
+    thread_count++;
+    ESP_LOGI(TAG, "Thread LVGL %s sur le cœur %d, priorité %u", name, (int)core, (unsigned)priority);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_delete(lv_thread_t* thread) {
+    if (thread->task) vTaskDelete(thread->task);
+    thread->task = NULL;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_init(lv_mutex_t* mutex) {
+    mutex->handle = xSemaphoreCreateRecursiveMutexStatic(&mutex->storage);
+    return mutex->handle ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_mutex_lock(lv_mutex_t* mutex) {
+    return xSemaphoreTakeRecursive(mutex->handle, portMAX_DELAY) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_mutex_lock_isr(lv_mutex_t* mutex) {
+    // Un mutex récursif ne se prend pas depuis une interruption
+    (void)mutex;
+    return LV_RESULT_INVALID;
+}
+
+lv_result_t lv_mutex_unlock(lv_mutex_t* mutex) {
+    return xSemaphoreGiveRecursive(mutex->handle) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_mutex_delete(lv_mutex_t* mutex) {
+    vSemaphoreDelete(mutex->handle);
+    mutex->handle = NULL;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_init(lv_thread_sync_t* sync) {
+    sync->handle = xSemaphoreCreateBinaryStatic(&sync->storage);
+    return sync->handle ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_thread_sync_wait(lv_thread_sync_t* sync) {
+    return xSemaphoreTake(sync->handle, portMAX_DELAY) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_thread_sync_signal(lv_thread_sync_t* sync) {
+    xSemaphoreGive(sync->handle);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_signal_isr(lv_thread_sync_t* sync) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(sync->handle, &woken);
+    portYIELD_FROM_ISR(woken);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_delete(lv_thread_sync_t* sync) {
+    vSemaphoreDelete(sync->handle);
+    sync->handle = NULL;
+    return LV_RESULT_OK;
+}
+
+uint32_t lv_os_get_idle_percent(void) {
+    return lv_timer_get_idle();
+}
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+// Portage OS de LVGL pour ESP-IDF (LV_USE_OS = LV_OS_CUSTOM). Celui de LVGL
+// (LV_OS_FREERTOS) crée ses threads sans affinité ; ici chaque thread, dans
+// l'ordre de création (une unité de dessin logicielle par thread), est
+// épinglé au cœur indiqué par LV_OS_ESP_THREAD_CORES : le premier partage le
+// cœur 1 avec la tâche UI, qui attend pendant le dessin, le second prend le
+// cœur 0. API de LVGL 9.2 (lv_thread_init nommé), version épinglée par
+// lvgl_version.cmake.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LV_OS_ESP_THREAD_CORES {1, 0}
+// Priorité maximale d'un thread sur le cœur 0 : sous la tâche de copie
+// LcdFlush (3) de DisplayDriver, qui préempte le dessin au lieu de partager
+// le cœur par tranches ; au-dessus de la surveillance (0)
+#define LV_OS_ESP_CORE0_MAX_PRIO 2
+
+typedef struct {
+    TaskHandle_t task;
+    void (*callback)(void*);
+    void* user_data;
+} lv_thread_t;
+
+// Mutex récursif : lv_lock() est repris par lv_timer_handler() dans la tâche UI
+typedef struct {
+    SemaphoreHandle_t handle;
+    StaticSemaphore_t storage;
+} lv_mutex_t;
+
+// Sémaphore binaire : un signal émis avant l'attente n'est pas perdu
+typedef struct {
+    SemaphoreHandle_t handle;
+    StaticSemaphore_t storage;
+} lv_thread_sync_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,18 @@
+# Version de LVGL épinglée pour le firmware et ui_bench : le portage OS
+# (lv_os_esp.c, lv_thread_init nommé) et les macros LV_DRAW_SW_*_RGB565 de
+# lv_blend_rgb565.h suivent l'API de cette version.
+#   git clone --branch v9.2.2 --depth 1 https://github.com/lvgl/lvgl components/lvgl/lvgl
+set(LVGL_PINNED_VERSION 9.2.2)
+
+function(lvgl_check_version lvgl_dir)
+    file(STRINGS ${lvgl_dir}/lv_version.h version_lines REGEX "^#define LVGL_VERSION_(MAJOR|MINOR|PATCH) ")
+    set(found "")
+    foreach(part MAJOR MINOR PATCH)
+        string(REGEX MATCH "LVGL_VERSION_${part} +([0-9]+)" _ "${version_lines}")
+        list(APPEND found ${CMAKE_MATCH_1})
+    endforeach()
+    list(JOIN found "." found)
+    if(NOT found VERSION_EQUAL LVGL_PINNED_VERSION)
+        message(FATAL_ERROR "LVGL ${found} dans ${lvgl_dir} : version attendue ${LVGL_PINNED_VERSION}")
+    endif()
+endfunction()
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Persistence interface shared by the gameplay components.
+//
+// Components do not talk to NVS or flash themselves: they register a
+// PersistentSection with the save system, which writes every section of
+// the save image in one pass and one commit, and hands each section a
+// read-only view of its bytes on load.
+
+// Section ids stored in the save image. Ids below 0x10 belong to the save
+// system itself (reptile records).
+enum PersistSectionId : uint16_t {
+    PERSIST_SECTION_FEEDING = 0x10,
+    PERSIST_SECTION_HABITAT = 0x11,
+    PERSIST_SECTION_HEALTH = 0x12,
+    PERSIST_SECTION_REPRODUCTION = 0x13
+};
+
+// Destination of a section's bytes during a batched save
+class PersistenceOutput {
+public:
+    virtual ~PersistenceOutput() = default;
+    virtual bool write(const void* data, size_t size) = 0;
+};
+
+class PersistentSection {
+public:
+    virtual ~PersistentSection() = default;
+
+    virtual uint16_t section_id() const = 0;
+    virtual const char* section_name() const = 0;
+
+    // Changed since the last successful save
+    virtual bool is_dirty() const = 0;
+    virtual void mark_clean() = 0;
+
+    virtual size_t serialized_size() const = 0;
+    virtual bool serialize(PersistenceOutput& out) const = 0;
+
+    // Zero-copy load: `data` stays valid until detach() is called
+    virtual bool attach(const uint8_t* data, size_t size) = 0;
+    // Called before the backing image goes away: copy what is still referenced
+    virtual void detach() = 0;
+};
+
+// Section backed by a single trivially copyable struct. Reads go straight
+// to the mapped image until the first edit() copies the value locally.
+template <typename T>
+class PodSection : public PersistentSection {
+private:
+    uint16_t id;
+    const char* name;
+    T local{};
+    const T* view = nullptr;
+    bool dirty = false;
+
+public:
+    PodSection(uint16_t section, const char* section_name) : id(section), name(section_name) {}
+
+    const T& get() const { return view ? *view : local; }
+    T& edit() {
+        detach();
+        dirty = true;
+        return local;
+    }
+    bool is_attached() const { return view != nullptr; }
+
+    uint16_t section_id() const override { return id; }
+    const char* section_name() const override { return name; }
+    bool is_dirty() const override { return dirty; }
+    void mark_clean() override { dirty = false; }
+    size_t serialized_size() const override { return sizeof(T); }
+
+    bool serialize(PersistenceOutput& out) const override {
+        return out.write(&get(), sizeof(T));
+    }
+
+    bool attach(const uint8_t* data, size_t size) override {
+        if (!data || size != sizeof(T) || reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+            return false;
+        }
+        view = reinterpret_cast<const T*>(data);
+        dirty = false;
+        return true;
+    }
+
+    void detach() override {
+        if (view) {
+            memcpy(&local, view, sizeof(T));
+            view = nullptr;
+        }
+    }
+};
+
+// Fixed-size set of registered sections (no allocation)
+class PersistenceRegistry {
+public:
+    static constexpr uint8_t MAX_SECTIONS = 7;
+
+private:
+    PersistentSection* sections[MAX_SECTIONS] = {};
+    uint8_t count = 0;
+
+public:
+    bool add(PersistentSection* section);
+    uint8_t size() const { return count; }
+    PersistentSection* get(uint8_t index) const { return index < count ? sections[index] : nullptr; }
+    PersistentSection* find(uint16_t id) const;
+
+    uint8_t dirty_count() const;
+    size_t total_size() const;
+    void detach_all();
+    void mark_all_clean();
+};
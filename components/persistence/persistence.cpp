@@ -0,0 +1,45 @@
+#include "persistence.h"
+
+bool PersistenceRegistry::add(PersistentSection* section) {
+    if (!section || count >= MAX_SECTIONS || section->section_id() < PERSIST_SECTION_FEEDING ||
+        find(section->section_id())) {
+        return false;
+    }
+    sections[count++] = section;
+    return true;
+}
+
+PersistentSection* PersistenceRegistry::find(uint16_t id) const {
+    for (uint8_t i = 0; i < count; i++) {
+        if (sections[i]->section_id() == id) return sections[i];
+    }
+    return nullptr;
+}
+
+uint8_t PersistenceRegistry::dirty_count() const {
+    uint8_t dirty = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (sections[i]->is_dirty()) dirty++;
+    }
+    return dirty;
+}
+
+size_t PersistenceRegistry::total_size() const {
+    size_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        total += sections[i]->serialized_size();
+    }
+    return total;
+}
+
+void PersistenceRegistry::detach_all() {
+    for (uint8_t i = 0; i < count; i++) {
+        sections[i]->detach();
+    }
+}
+
+void PersistenceRegistry::mark_all_clean() {
+    for (uint8_t i = 0; i < count; i++) {
+        sections[i]->mark_clean();
+    }
+}
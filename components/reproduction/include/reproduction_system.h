@@ -1,5 +1,19 @@
 #pragma once
 
-// Minimal interface for the reproduction system
-bool save_reproduction_data();
-bool load_reproduction_data();
+#include "persistence.h"
+#include <stdint.h>
+
+// Persistent state of the reproduction system, stored as its own save section
+struct ReproductionState {
+    uint32_t breeding_attempts; // Pairings attempted
+    uint32_t clutches;          // Successful pairings
+    uint32_t last_breeding_ms;  // Game time of the last successful pairing
+    uint32_t reserved;
+};
+
+const ReproductionState& reproduction_state();
+void reproduction_record_attempt(uint32_t timestamp_ms, bool success);
+
+// Section registered with the save system; changes are written with the
+// next batched save
+PersistentSection& reproduction_persistence();
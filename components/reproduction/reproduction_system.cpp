@@ -1,9 +1,20 @@
 #include "reproduction_system.h"
 
-bool save_reproduction_data() {
-    return false;
+static PodSection<ReproductionState> section(PERSIST_SECTION_REPRODUCTION, "reproduction");
+
+const ReproductionState& reproduction_state() {
+    return section.get();
+}
+
+void reproduction_record_attempt(uint32_t timestamp_ms, bool success) {
+    ReproductionState& state = section.edit();
+    state.breeding_attempts++;
+    if (success) {
+        state.clutches++;
+        state.last_breeding_ms = timestamp_ms;
+    }
 }
 
-bool load_reproduction_data() {
-    return false;
+PersistentSection& reproduction_persistence() {
+    return section;
 }
@@ -0,0 +1,45 @@
+#pragma once
+
+// Branchement des noyaux RGB565 dans le rendu logiciel de LVGL 9
+// (LV_USE_DRAW_SW_ASM = LV_DRAW_SW_ASM_CUSTOM). Inclus par
+// lv_draw_sw_blend_to_rgb565.c : chaque macro rend LV_RESULT_INVALID quand le
+// noyau ne couvre pas le cas, LVGL exécute alors sa propre boucle.
+// Les variantes « _WITH_MASK » ne sont appelées qu'à opacité pleine.
+
+#include "rgb565_kernels.h"
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    (rgb565_fill((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                 lv_color_to_u16((dsc)->color), NULL, 0, 255) ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    (rgb565_fill((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                 lv_color_to_u16((dsc)->color), NULL, 0, (dsc)->opa) ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    (rgb565_fill((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                 lv_color_to_u16((dsc)->color), (dsc)->mask_buf, (dsc)->mask_stride, 255) \
+         ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    (rgb565_fill((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                 lv_color_to_u16((dsc)->color), (dsc)->mask_buf, (dsc)->mask_stride, (dsc)->opa) \
+         ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+    (rgb565_blend((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                  (dsc)->src_buf, (dsc)->src_stride, NULL, 0, 255) ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) \
+    (rgb565_blend((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                  (dsc)->src_buf, (dsc)->src_stride, NULL, 0, (dsc)->opa) ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) \
+    (rgb565_blend((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                  (dsc)->src_buf, (dsc)->src_stride, (dsc)->mask_buf, (dsc)->mask_stride, 255) \
+         ? LV_RESULT_OK : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc) \
+    (rgb565_blend((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                  (dsc)->src_buf, (dsc)->src_stride, (dsc)->mask_buf, (dsc)->mask_stride, (dsc)->opa) \
+         ? LV_RESULT_OK : LV_RESULT_INVALID)
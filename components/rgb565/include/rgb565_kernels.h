@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Noyaux RGB565 du rendu logiciel LVGL : remplissage uni, remplissage avec
+// opacité et/ou masque A8 (glyphes, coins arrondis, ombres) et copie / mélange
+// d'image RGB565. Résultats identiques au bit près aux boucles génériques de
+// LVGL (lv_color_16_16_mix : opacité réduite à 5 bits, arrondi par défaut).
+// Pas en octets, comme les descripteurs de mélange de LVGL.
+typedef enum {
+    RGB565_ISA_NONE = 0,    // Boucles génériques de LVGL
+    RGB565_ISA_SSE2,        // Hôte x86
+    RGB565_ISA_AVX2,        // Hôte x86, détecté à l'exécution
+    RGB565_ISA_PIE          // ESP32-S3
+} rgb565_isa_t;
+
+rgb565_isa_t rgb565_get_isa(void);
+// Banc d'essai et tests : bride le jeu d'instructions (jamais au-delà du détecté)
+void rgb565_force_isa(rgb565_isa_t isa);
+const char* rgb565_isa_name(rgb565_isa_t isa);
+
+// `mask` : NULL ou une opacité par pixel ; `opa` appliqué en plus du masque.
+// false si aucun noyau vectoriel ne couvre le cas : LVGL garde sa boucle
+bool rgb565_fill(void* dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                 const uint8_t* mask, int32_t mask_stride, uint8_t opa);
+bool rgb565_blend(void* dest, int32_t w, int32_t h, int32_t dest_stride, const void* src, int32_t src_stride,
+                  const uint8_t* mask, int32_t mask_stride, uint8_t opa);
+
+// Références scalaires, calquées sur les boucles génériques de LVGL
+void rgb565_fill_scalar(void* dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                        const uint8_t* mask, int32_t mask_stride, uint8_t opa);
+void rgb565_blend_scalar(void* dest, int32_t w, int32_t h, int32_t dest_stride, const void* src, int32_t src_stride,
+                         const uint8_t* mask, int32_t mask_stride, uint8_t opa);
+
+#ifdef __cplusplus
+}
+#endif
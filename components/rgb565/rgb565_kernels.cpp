@@ -0,0 +1,475 @@
+#include "rgb565_kernels.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(ESP_PLATFORM)
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#define RGB565_HAVE_PIE 1
+#endif
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RGB565_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Scalaire : mêmes formules que lv_draw_sw_blend_to_rgb565.c
+
+// Opacité ramenée sur 5 bits ; les trois canaux sont mélangés d'un coup dans
+// un mot de 32 bits où le vert est déplacé dans la moitié haute
+static inline uint16_t mix565(uint16_t fg, uint16_t bg, uint8_t mix) {
+    if (mix == 255) return fg;
+    if (mix == 0) return bg;
+    uint32_t m = ((uint32_t)mix + 4) >> 3;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t r = ((((f - b) * m) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)((r >> 16) | r);
+}
+
+// LV_OPA_MIX2 ; opa == 255 : masque seul
+static inline uint8_t mask_opa(uint8_t mask, uint8_t opa) {
+    return opa == 255 ? mask : (uint8_t)(((uint32_t)mask * opa) >> 8);
+}
+
+static void fill_row_scalar(uint16_t* d, int32_t x, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa) {
+    if (!mask) {
+        if (opa == 255) {
+            for (; x < w; x++) d[x] = color;
+        } else {
+            for (; x < w; x++) d[x] = mix565(color, d[x], opa);
+        }
+        return;
+    }
+    for (; x < w; x++) d[x] = mix565(color, d[x], mask_opa(mask[x], opa));
+}
+
+static void blend_row_scalar(uint16_t* d, int32_t x, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    if (!mask) {
+        for (; x < w; x++) d[x] = mix565(s[x], d[x], opa);
+        return;
+    }
+    for (; x < w; x++) d[x] = mix565(s[x], d[x], mask_opa(mask[x], opa));
+}
+
+typedef void (*FillRow)(uint16_t* d, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa);
+typedef void (*BlendRow)(uint16_t* d, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa);
+
+static void fill_rows(FillRow row, void* dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                      const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    uint8_t* d = static_cast<uint8_t*>(dest);
+    for (int32_t y = 0; y < h; y++) {
+        row(reinterpret_cast<uint16_t*>(d), w, color, mask, opa);
+        d += dest_stride;
+        if (mask) mask += mask_stride;
+    }
+}
+
+static void blend_rows(BlendRow row, void* dest, int32_t w, int32_t h, int32_t dest_stride, const void* src,
+                       int32_t src_stride, const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    uint8_t* d = static_cast<uint8_t*>(dest);
+    const uint8_t* s = static_cast<const uint8_t*>(src);
+    for (int32_t y = 0; y < h; y++) {
+        if (!mask && opa == 255) memcpy(d, s, (size_t)w * 2);
+        else row(reinterpret_cast<uint16_t*>(d), w, reinterpret_cast<const uint16_t*>(s), mask, opa);
+        d += dest_stride;
+        s += src_stride;
+        if (mask) mask += mask_stride;
+    }
+}
+
+static void fill_row_generic(uint16_t* d, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa) {
+    fill_row_scalar(d, 0, w, color, mask, opa);
+}
+
+static void blend_row_generic(uint16_t* d, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    blend_row_scalar(d, 0, w, s, mask, opa);
+}
+
+// ---------------------------------------------------------------------------
+// x86 : canaux séparés dans des voies de 16 bits. Avec m sur 5 bits,
+// bg + ((fg - bg) * m >> 5) (décalage arithmétique) redonne exactement le
+// mélange 32 bits de LVGL, retenues comprises.
+
+#ifdef RGB565_HAVE_X86
+__attribute__((target("sse2")))
+static inline __m128i mix_sse2(__m128i fg, __m128i bg, __m128i m) {
+    const __m128i five = _mm_set1_epi16(0x1F);
+    const __m128i six = _mm_set1_epi16(0x3F);
+    __m128i fr = _mm_srli_epi16(fg, 11), br = _mm_srli_epi16(bg, 11);
+    __m128i fgr = _mm_and_si128(_mm_srli_epi16(fg, 5), six), bgr = _mm_and_si128(_mm_srli_epi16(bg, 5), six);
+    __m128i fb = _mm_and_si128(fg, five), bb = _mm_and_si128(bg, five);
+    __m128i r = _mm_add_epi16(br, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fr, br), m), 5));
+    __m128i g = _mm_add_epi16(bgr, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fgr, bgr), m), 5));
+    __m128i b = _mm_add_epi16(bb, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fb, bb), m), 5));
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+// Opacité par pixel sur 5 bits, depuis 8 octets de masque
+__attribute__((target("sse2")))
+static inline __m128i mask5_sse2(const uint8_t* mask, uint8_t opa) {
+    __m128i m = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask)), _mm_setzero_si128());
+    if (opa != 255) m = _mm_srli_epi16(_mm_mullo_epi16(m, _mm_set1_epi16(opa)), 8);
+    return _mm_srli_epi16(_mm_add_epi16(m, _mm_set1_epi16(4)), 3);
+}
+
+// Bloc de 8 pixels calculé sans être écrit ; `m` sert quand il n'y a pas de masque
+__attribute__((target("sse2")))
+static inline __m128i fill8_sse2(const uint16_t* d, __m128i fg, const uint8_t* mask, uint8_t opa, __m128i m) {
+    if (mask) m = mask5_sse2(mask, opa);
+    return mix_sse2(fg, _mm_loadu_si128(reinterpret_cast<const __m128i*>(d)), m);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i blend8_sse2(const uint16_t* d, const uint16_t* s, const uint8_t* mask, uint8_t opa, __m128i m) {
+    if (mask) m = mask5_sse2(mask, opa);
+    __m128i fg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    return mix_sse2(fg, _mm_loadu_si128(reinterpret_cast<const __m128i*>(d)), m);
+}
+
+__attribute__((target("sse2")))
+static inline void store8(uint16_t* d, __m128i px) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d), px);
+}
+
+static inline int16_t opa5(uint8_t opa) {
+    return (int16_t)(((uint32_t)opa + 4) >> 3);
+}
+
+// Fin de ligne : les 8 derniers pixels sont calculés avant toute écriture,
+// depuis le fond d'origine, puis écrits en dernier. Les pixels repris par
+// le recouvrement reçoivent la même valeur ; les glyphes et les bords
+// arrondis, étroits, évitent ainsi une queue scalaire.
+
+__attribute__((target("sse2")))
+static void fill_row_sse2(uint16_t* d, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa) {
+    int32_t x = 0;
+    __m128i fg = _mm_set1_epi16((short)color);
+    if (!mask && opa == 255) {
+        for (; x + 8 <= w; x += 8) store8(d + x, fg);
+        fill_row_scalar(d, x, w, color, nullptr, 255);
+        return;
+    }
+    if (w < 8) {
+        fill_row_scalar(d, 0, w, color, mask, opa);
+        return;
+    }
+    __m128i m = _mm_set1_epi16(opa5(opa));
+    int32_t last = w - 8;
+    __m128i tail = fill8_sse2(d + last, fg, mask ? mask + last : nullptr, opa, m);
+    for (; x + 8 <= w; x += 8) store8(d + x, fill8_sse2(d + x, fg, mask ? mask + x : nullptr, opa, m));
+    if (x < w) store8(d + last, tail);
+}
+
+__attribute__((target("sse2")))
+static void blend_row_sse2(uint16_t* d, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    if (w < 8) {
+        blend_row_scalar(d, 0, w, s, mask, opa);
+        return;
+    }
+    int32_t x = 0;
+    __m128i m = _mm_set1_epi16(opa5(opa));
+    int32_t last = w - 8;
+    __m128i tail = blend8_sse2(d + last, s + last, mask ? mask + last : nullptr, opa, m);
+    for (; x + 8 <= w; x += 8) store8(d + x, blend8_sse2(d + x, s + x, mask ? mask + x : nullptr, opa, m));
+    if (x < w) store8(d + last, tail);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i mix_avx2(__m256i fg, __m256i bg, __m256i m) {
+    const __m256i five = _mm256_set1_epi16(0x1F);
+    const __m256i six = _mm256_set1_epi16(0x3F);
+    __m256i fr = _mm256_srli_epi16(fg, 11), br = _mm256_srli_epi16(bg, 11);
+    __m256i fgr = _mm256_and_si256(_mm256_srli_epi16(fg, 5), six), bgr = _mm256_and_si256(_mm256_srli_epi16(bg, 5), six);
+    __m256i fb = _mm256_and_si256(fg, five), bb = _mm256_and_si256(bg, five);
+    __m256i r = _mm256_add_epi16(br, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fr, br), m), 5));
+    __m256i g = _mm256_add_epi16(bgr, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fgr, bgr), m), 5));
+    __m256i b = _mm256_add_epi16(bb, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fb, bb), m), 5));
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i mask5_avx2(const uint8_t* mask, uint8_t opa) {
+    __m256i m = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+    if (opa != 255) m = _mm256_srli_epi16(_mm256_mullo_epi16(m, _mm256_set1_epi16(opa)), 8);
+    return _mm256_srli_epi16(_mm256_add_epi16(m, _mm256_set1_epi16(4)), 3);
+}
+
+// 16 pixels par tour, puis au plus un bloc SSE et la fin de ligne
+__attribute__((target("avx2")))
+static void fill_row_avx2(uint16_t* d, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa) {
+    int32_t x = 0;
+    __m256i fg = _mm256_set1_epi16((short)color);
+    if (!mask && opa == 255) {
+        for (; x + 16 <= w; x += 16) _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + x), fg);
+        fill_row_scalar(d, x, w, color, nullptr, 255);
+        return;
+    }
+    if (w < 8) {
+        fill_row_scalar(d, 0, w, color, mask, opa);
+        return;
+    }
+    __m256i m = _mm256_set1_epi16(opa5(opa));
+    __m128i fg8 = _mm256_castsi256_si128(fg);
+    __m128i m8 = _mm256_castsi256_si128(m);
+    int32_t last = w - 8;
+    __m128i tail = fill8_sse2(d + last, fg8, mask ? mask + last : nullptr, opa, m8);
+    for (; x + 16 <= w; x += 16) {
+        __m256i mx = mask ? mask5_avx2(mask + x, opa) : m;
+        __m256i bg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + x), mix_avx2(fg, bg, mx));
+    }
+    if (x + 8 <= w) {
+        store8(d + x, fill8_sse2(d + x, fg8, mask ? mask + x : nullptr, opa, m8));
+        x += 8;
+    }
+    if (x < w) store8(d + last, tail);
+}
+
+__attribute__((target("avx2")))
+static void blend_row_avx2(uint16_t* d, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    if (w < 8) {
+        blend_row_scalar(d, 0, w, s, mask, opa);
+        return;
+    }
+    int32_t x = 0;
+    __m256i m = _mm256_set1_epi16(opa5(opa));
+    __m128i m8 = _mm256_castsi256_si128(m);
+    int32_t last = w - 8;
+    __m128i tail = blend8_sse2(d + last, s + last, mask ? mask + last : nullptr, opa, m8);
+    for (; x + 16 <= w; x += 16) {
+        __m256i mx = mask ? mask5_avx2(mask + x, opa) : m;
+        __m256i fg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + x));
+        __m256i bg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + x), mix_avx2(fg, bg, mx));
+    }
+    if (x + 8 <= w) {
+        store8(d + x, blend8_sse2(d + x, s + x, mask ? mask + x : nullptr, opa, m8));
+        x += 8;
+    }
+    if (x < w) store8(d + last, tail);
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// ESP32-S3 : stores et calculs PIE de 128 bits alignés (8 pixels)
+
+#ifdef RGB565_HAVE_PIE
+static const uint16_t pie_masks[2] = {0x001F, 0x07E0};
+
+// Mélange de `blocks` blocs de 8 pixels, `d` aligné sur 16 octets. `f` et
+// `m` (opacités sur 5 bits) avancent de leur pas : 0 pour une couleur ou
+// une opacité uniformes, 16 pour une image ou un masque. Bleu et vert sont
+// isolés en place, le rouge ramené en bas par un décalage 32 bits dont les
+// débordements sont masqués ; puis bg + ((fg - bg) * m >> 5) par
+// ee.vmul.s16 avec SAR = 5, comme mix_sse2. Le vert, multiple de 32, est
+// arrondi après l'ajout du fond.
+static void mix_blocks_pie(uint16_t* d, const uint16_t* f, uint32_t f_step, const uint16_t* m, uint32_t m_step,
+                           uint32_t blocks) {
+    const uint16_t* k = pie_masks;
+    uint16_t* src = d;
+    asm volatile(
+        "ee.vldbc.16.ip q3, %[k], 2\n"
+        "ee.vldbc.16 q4, %[k]\n"
+        "ssai 5\n"
+        "1:\n"
+        "ee.vld.128.xp q0, %[m], %[ms]\n"
+        "ee.vld.128.xp q1, %[f], %[fs]\n"
+        "ee.vld.128.ip q2, %[s], 16\n"
+        // Bleu
+        "ee.andq q5, q1, q3\n"
+        "ee.andq q6, q2, q3\n"
+        "ee.vsubs.s16 q5, q5, q6\n"
+        "ee.vmul.s16 q5, q5, q0\n"
+        "ee.vadds.s16 q7, q5, q6\n"
+        // Vert
+        "ee.andq q5, q1, q4\n"
+        "ee.andq q6, q2, q4\n"
+        "ee.vsubs.s16 q5, q5, q6\n"
+        "ee.vmul.s16 q5, q5, q0\n"
+        "ee.vadds.s16 q5, q5, q6\n"
+        "ee.andq q6, q5, q3\n"
+        "ee.xorq q5, q5, q6\n"
+        "ee.orq q7, q7, q5\n"
+        // Rouge
+        "ssai 11\n"
+        "ee.vsr.32 q5, q1\n"
+        "ee.vsr.32 q6, q2\n"
+        "ssai 5\n"
+        "ee.andq q5, q5, q3\n"
+        "ee.andq q6, q6, q3\n"
+        "ee.vsubs.s16 q5, q5, q6\n"
+        "ee.vmul.s16 q5, q5, q0\n"
+        "ee.vadds.s16 q5, q5, q6\n"
+        "ssai 11\n"
+        "ee.vsl.32 q5, q5\n"
+        "ssai 5\n"
+        "ee.orq q7, q7, q5\n"
+        "ee.vst.128.ip q7, %[d], 16\n"
+        "addi %[n], %[n], -1\n"
+        "bnez %[n], 1b\n"
+        : [d] "+r"(d), [s] "+r"(src), [f] "+r"(f), [m] "+r"(m), [k] "+r"(k), [n] "+r"(blocks)
+        : [fs] "r"(f_step), [ms] "r"(m_step)
+        : "memory");
+}
+
+// Tronçons de 64 pixels : image désalignée et opacités du masque sur 5 bits
+// préparées dans des tampons alignés sur la pile (256 octets)
+static constexpr int32_t PIE_CHUNK = 64;
+
+static void mix_row_pie(uint16_t* d, int32_t w, uint16_t color, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    int32_t x = 0;
+    for (; x < w && (reinterpret_cast<uintptr_t>(d + x) & 15); x++) {
+        d[x] = mix565(s ? s[x] : color, d[x], mask ? mask_opa(mask[x], opa) : opa);
+    }
+    alignas(16) uint16_t fg[PIE_CHUNK];
+    alignas(16) uint16_t m5[PIE_CHUNK];
+    if (!s) for (int32_t i = 0; i < 8; i++) fg[i] = color;
+    if (!mask) for (int32_t i = 0; i < 8; i++) m5[i] = (uint16_t)(((uint32_t)opa + 4) >> 3);
+
+    while (w - x >= 8) {
+        int32_t n = std::min(PIE_CHUNK, (w - x) & ~7);
+        const uint16_t* f = fg;
+        if (s) {
+            if (reinterpret_cast<uintptr_t>(s + x) & 15) memcpy(fg, s + x, (size_t)n * 2);
+            else f = s + x;
+        }
+        if (mask) {
+            for (int32_t i = 0; i < n; i++) m5[i] = (uint16_t)(((uint32_t)mask_opa(mask[x + i], opa) + 4) >> 3);
+        }
+        mix_blocks_pie(d + x, f, s ? 16 : 0, m5, mask ? 16 : 0, (uint32_t)n / 8);
+        x += n;
+    }
+    for (; x < w; x++) d[x] = mix565(s ? s[x] : color, d[x], mask ? mask_opa(mask[x], opa) : opa);
+}
+
+static void fill_row_pie(uint16_t* d, int32_t w, uint16_t color, const uint8_t* mask, uint8_t opa) {
+    if (mask || opa != 255) {
+        mix_row_pie(d, w, color, nullptr, mask, opa);
+        return;
+    }
+    int32_t x = 0;
+    // Tête jusqu'à l'alignement sur 16 octets exigé par ee.vst.128.ip
+    while (x < w && (reinterpret_cast<uintptr_t>(d + x) & 15)) d[x++] = color;
+    uint32_t blocks = (uint32_t)(w - x) / 8;
+    if (blocks) {
+        uint16_t* p = d + x;
+        asm volatile(
+            "ee.vldbc.16 q0, %[c]\n"
+            "1:\n"
+            "ee.vst.128.ip q0, %[p], 16\n"
+            "addi %[n], %[n], -1\n"
+            "bnez %[n], 1b\n"
+            : [p] "+r"(p), [n] "+r"(blocks)
+            : [c] "r"(&color)
+            : "memory");
+        x += (int32_t)((p - (d + x)));
+    }
+    fill_row_scalar(d, x, w, color, nullptr, 255);
+}
+
+static void blend_row_pie(uint16_t* d, int32_t w, const uint16_t* s, const uint8_t* mask, uint8_t opa) {
+    mix_row_pie(d, w, 0, s, mask, opa);
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Sélection
+
+static rgb565_isa_t detect_isa() {
+#if defined(RGB565_HAVE_X86)
+    return __builtin_cpu_supports("avx2") ? RGB565_ISA_AVX2 : RGB565_ISA_SSE2;
+#elif defined(RGB565_HAVE_PIE)
+    return RGB565_ISA_PIE;
+#else
+    return RGB565_ISA_NONE;
+#endif
+}
+
+static rgb565_isa_t detected_isa() {
+    static const rgb565_isa_t isa = detect_isa();
+    return isa;
+}
+
+static rgb565_isa_t active_isa = detected_isa();
+
+// En deçà, les lignes SSE2 battent AVX2 (glyphes, bords) : moins de pixels
+// traités par le dernier bloc recouvrant, pas de transition de largeur
+static constexpr int32_t AVX2_MIN_WIDTH = 32;
+
+rgb565_isa_t rgb565_get_isa(void) {
+    return active_isa;
+}
+
+void rgb565_force_isa(rgb565_isa_t isa) {
+    rgb565_isa_t detected = detected_isa();
+    if (isa == RGB565_ISA_NONE || isa == detected) active_isa = isa;
+    else if (detected == RGB565_ISA_AVX2 && isa == RGB565_ISA_SSE2) active_isa = isa;
+}
+
+const char* rgb565_isa_name(rgb565_isa_t isa) {
+    switch (isa) {
+        case RGB565_ISA_SSE2: return "sse2";
+        case RGB565_ISA_AVX2: return "avx2";
+        case RGB565_ISA_PIE: return "pie";
+        default: return "générique";
+    }
+}
+
+bool rgb565_fill(void* dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                 const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    switch (active_isa) {
+#ifdef RGB565_HAVE_X86
+        case RGB565_ISA_AVX2:
+            if (w >= AVX2_MIN_WIDTH) {
+                fill_rows(fill_row_avx2, dest, w, h, dest_stride, color, mask, mask_stride, opa);
+                return true;
+            }
+            [[fallthrough]];
+        case RGB565_ISA_SSE2:
+            fill_rows(fill_row_sse2, dest, w, h, dest_stride, color, mask, mask_stride, opa);
+            return true;
+#endif
+#ifdef RGB565_HAVE_PIE
+        case RGB565_ISA_PIE:
+            fill_rows(fill_row_pie, dest, w, h, dest_stride, color, mask, mask_stride, opa);
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool rgb565_blend(void* dest, int32_t w, int32_t h, int32_t dest_stride, const void* src, int32_t src_stride,
+                  const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    switch (active_isa) {
+#ifdef RGB565_HAVE_X86
+        case RGB565_ISA_AVX2:
+            if (w >= AVX2_MIN_WIDTH) {
+                blend_rows(blend_row_avx2, dest, w, h, dest_stride, src, src_stride, mask, mask_stride, opa);
+                return true;
+            }
+            [[fallthrough]];
+        case RGB565_ISA_SSE2:
+            blend_rows(blend_row_sse2, dest, w, h, dest_stride, src, src_stride, mask, mask_stride, opa);
+            return true;
+#endif
+#ifdef RGB565_HAVE_PIE
+        case RGB565_ISA_PIE:
+            blend_rows(blend_row_pie, dest, w, h, dest_stride, src, src_stride, mask, mask_stride, opa);
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+void rgb565_fill_scalar(void* dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                        const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    fill_rows(fill_row_generic, dest, w, h, dest_stride, color, mask, mask_stride, opa);
+}
+
+void rgb565_blend_scalar(void* dest, int32_t w, int32_t h, int32_t dest_stride, const void* src, int32_t src_stride,
+                         const uint8_t* mask, int32_t mask_stride, uint8_t opa) {
+    blend_rows(blend_row_generic, dest, w, h, dest_stride, src, src_stride, mask, mask_stride, opa);
+}
@@ -0,0 +1,99 @@
+#include "include/autosave_policy.h"
+
+static constexpr uint64_t DAY_MS = 24ULL * 60 * 60 * 1000;
+// En deçà, le rythme de session n'est pas représentatif : le budget sert d'estimation
+static constexpr uint32_t MIN_RATE_WINDOW_MS = 10 * 60 * 1000;
+
+const char* AutosavePolicy::decision_name(Decision decision) {
+    switch (decision) {
+        case SKIP_CLEAN: return "propre";
+        case SKIP_INTERVAL: return "intervalle";
+        case DEFER_BUDGET: return "budget";
+        case SAVE_DIRTY: return "changements";
+        case SAVE_EVENT: return "événement";
+        case SAVE_MAX_INTERVAL: return "intervalle max";
+    }
+    return "?";
+}
+
+void AutosavePolicy::configure(const Config& cfg) {
+    config = cfg;
+    if (config.target_lifetime_days == 0) config.target_lifetime_days = 1;
+    if (budget_tokens > bucket_capacity()) budget_tokens = bucket_capacity();
+}
+
+uint64_t AutosavePolicy::daily_budget_bytes() const {
+    return (uint64_t)config.wear_area_bytes * config.erase_cycles / config.target_lifetime_days;
+}
+
+int64_t AutosavePolicy::bucket_capacity() const {
+    return (int64_t)(daily_budget_bytes() * config.burst_ms / DAY_MS);
+}
+
+void AutosavePolicy::refill(uint32_t now_ms) {
+    if (!started) {
+        // Seau plein au démarrage : la première sauvegarde n'attend pas
+        started = true;
+        session_start_ms = now_ms;
+        last_save_ms = now_ms;
+        last_refill_ms = now_ms;
+        budget_tokens = bucket_capacity();
+        return;
+    }
+
+    uint32_t elapsed = now_ms - last_refill_ms;
+    int64_t earned = (int64_t)(daily_budget_bytes() * elapsed / DAY_MS);
+    if (earned == 0) return; // Reliquat conservé jusqu'au prochain appel
+    last_refill_ms = now_ms;
+    budget_tokens += earned;
+    if (budget_tokens > bucket_capacity()) budget_tokens = bucket_capacity();
+}
+
+AutosavePolicy::Decision AutosavePolicy::evaluate(uint32_t now_ms, uint32_t change_weight, uint32_t events) {
+    refill(now_ms);
+
+    if (events != 0) return SAVE_EVENT;
+    if (change_weight == 0 && now_ms - last_save_ms < config.max_interval_ms) return SKIP_CLEAN;
+
+    bool overdue = now_ms - last_save_ms >= config.max_interval_ms;
+    if (!overdue && (change_weight < config.dirty_threshold ||
+                     now_ms - last_save_ms < config.min_interval_ms)) {
+        return SKIP_INTERVAL;
+    }
+
+    // Une sauvegarde efface au moins un secteur
+    if (budget_tokens < 4096) return DEFER_BUDGET;
+    return overdue ? SAVE_MAX_INTERVAL : SAVE_DIRTY;
+}
+
+void AutosavePolicy::record_write(uint32_t now_ms, size_t erased_bytes) {
+    record_erase(now_ms, erased_bytes);
+    last_save_ms = now_ms;
+}
+
+void AutosavePolicy::record_erase(uint32_t now_ms, size_t erased_bytes) {
+    refill(now_ms);
+    budget_tokens -= erased_bytes;
+    lifetime_erased += erased_bytes;
+    session_erased += erased_bytes;
+}
+
+uint64_t AutosavePolicy::session_daily_rate(uint32_t now_ms) const {
+    uint32_t elapsed = now_ms - session_start_ms;
+    if (!started || elapsed < MIN_RATE_WINDOW_MS) return daily_budget_bytes();
+    return session_erased * DAY_MS / elapsed;
+}
+
+uint32_t AutosavePolicy::projected_lifetime_days(uint32_t now_ms) const {
+    uint64_t endurance = (uint64_t)config.wear_area_bytes * config.erase_cycles;
+    if (lifetime_erased >= endurance) return 0;
+    uint64_t rate = session_daily_rate(now_ms);
+    if (rate == 0) return UINT32_MAX;
+    uint64_t days = (endurance - lifetime_erased) / rate;
+    return days > UINT32_MAX ? UINT32_MAX : (uint32_t)days;
+}
+
+uint32_t AutosavePolicy::wear_millicycles() const {
+    if (config.wear_area_bytes == 0) return 0;
+    return (uint32_t)(lifetime_erased * 1000 / config.wear_area_bytes);
+}
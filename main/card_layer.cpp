@@ -0,0 +1,80 @@
+#include "include/card_layer.h"
+#include <math.h>
+
+static inline uint16_t to_rgb565(float r, float g, float b) {
+    return (uint16_t)((((uint16_t)(r + 0.5f) >> 3) << 11) | (((uint16_t)(g + 0.5f) >> 2) << 5) |
+                      ((uint16_t)(b + 0.5f) >> 3));
+}
+
+static inline float channel(uint32_t rgb, int shift) {
+    return (float)((rgb >> shift) & 0xFF);
+}
+
+uint16_t card_layer_extent(const CardLayerKey& key) {
+    return key.shadow_width ? key.shadow_width / 2 + 1 : 0;
+}
+
+CardStripRect card_layer_strip(const CardLayerKey& key, CardStrip strip) {
+    int16_t s = (int16_t)card_layer_extent(key);
+    uint16_t r = key.radius;
+    if (2 * r > key.width) r = key.width / 2;
+    if (2 * r > key.height) r = key.height / 2;
+    uint16_t full_width = key.width + 2 * s;
+    uint16_t side_height = key.height > 2 * r ? key.height - 2 * r : 0;
+
+    switch (strip) {
+        case CARD_STRIP_TOP:    return {(int16_t)-s, (int16_t)-s, full_width, (uint16_t)(s + r)};
+        case CARD_STRIP_BOTTOM: return {(int16_t)-s, (int16_t)(key.height - r), full_width, (uint16_t)(s + r)};
+        case CARD_STRIP_LEFT:   return {(int16_t)-s, (int16_t)r, (uint16_t)s, side_height};
+        case CARD_STRIP_RIGHT:  return {(int16_t)key.width, (int16_t)r, (uint16_t)s, side_height};
+        default:                return {0, 0, 0, 0};
+    }
+}
+
+size_t card_layer_bytes(const CardLayerKey& key) {
+    size_t bytes = 0;
+    for (uint8_t i = 0; i < CARD_STRIP_COUNT; i++) {
+        CardStripRect rect = card_layer_strip(key, (CardStrip)i);
+        bytes += (size_t)rect.width * rect.height * sizeof(uint16_t);
+    }
+    return bytes;
+}
+
+uint16_t card_layer_pixel(const CardLayerKey& key, int x, int y) {
+    // Distance signée au rectangle arrondi (négative à l'intérieur), au centre du pixel
+    float r = key.radius;
+    if (2 * r > key.width) r = key.width / 2.0f;
+    if (2 * r > key.height) r = key.height / 2.0f;
+    float half_w = key.width / 2.0f;
+    float half_h = key.height / 2.0f;
+    float px = fabsf(x + 0.5f - half_w) - (half_w - r);
+    float py = fabsf(y + 0.5f - half_h) - (half_h - r);
+    float outside = sqrtf(fmaxf(px, 0.0f) * fmaxf(px, 0.0f) + fmaxf(py, 0.0f) * fmaxf(py, 0.0f));
+    float d = outside + fminf(fmaxf(px, py), 0.0f) - r;
+
+    // Ombre : flou linéaire de -sw/2 à +sw/2 autour du bord (approximation du flou LVGL)
+    float shadow = 0.0f;
+    if (key.shadow_width) {
+        float t = (key.shadow_width / 2.0f - d) / key.shadow_width;
+        shadow = fminf(fmaxf(t, 0.0f), 1.0f) * key.shadow_opa / 255.0f;
+    }
+    // Anticrénelage du bord de la carte sur un pixel
+    float cover = fminf(fmaxf(0.5f - d, 0.0f), 1.0f);
+
+    float out[3];
+    for (int c = 0; c < 3; c++) {
+        int shift = 16 - 8 * c;
+        float base = channel(key.backdrop_rgb, shift) * (1.0f - shadow) + channel(key.shadow_rgb, shift) * shadow;
+        out[c] = base * (1.0f - cover) + channel(key.bg_rgb, shift) * cover;
+    }
+    return to_rgb565(out[0], out[1], out[2]);
+}
+
+void card_layer_render(const CardLayerKey& key, CardStrip strip, uint16_t* out) {
+    CardStripRect rect = card_layer_strip(key, strip);
+    for (uint16_t row = 0; row < rect.height; row++) {
+        for (uint16_t col = 0; col < rect.width; col++) {
+            *out++ = card_layer_pixel(key, rect.x + col, rect.y + row);
+        }
+    }
+}
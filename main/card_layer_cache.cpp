@@ -0,0 +1,203 @@
+#include "include/card_layer_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <cstring>
+
+static const char* TAG = "CardLayers";
+
+CardLayerCache::CardLayerCache() {
+    lv_style_init(&flat_style);
+    lv_style_set_shadow_width(&flat_style, 0);
+}
+
+void CardLayerCache::set_style(const Style& card_style) {
+    style = card_style;
+    // Nouveau style : toutes les couches sont refaites
+    for (uint8_t i = 0; i < MAX_CARDS; i++) {
+        if (cards[i].obj) refresh(cards[i]);
+    }
+}
+
+CardLayerCache::Card* CardLayerCache::find_card(lv_obj_t* obj) {
+    for (uint8_t i = 0; i < MAX_CARDS; i++) {
+        if (cards[i].obj == obj) return &cards[i];
+    }
+    return nullptr;
+}
+
+bool CardLayerCache::attach(lv_obj_t* obj) {
+    if (!obj || find_card(obj)) return false;
+    Card* card = find_card(nullptr);
+    if (!card) return false; // Carte servie par l'ombre LVGL
+
+    card->obj = obj;
+    card->layer = -1;
+    card->flat = false;
+    for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) card->strips[s] = nullptr;
+
+    // Taille et position appliquées avant l'abonnement : la couche est rendue
+    // à la taille définitive, sans second rendu au SIZE_CHANGED
+    lv_obj_update_layout(obj);
+
+    // Les bandes débordent de la carte, sous ses enfants dynamiques
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_add_event_cb(obj, on_card_event, LV_EVENT_SIZE_CHANGED, this);
+    lv_obj_add_event_cb(obj, on_card_event, LV_EVENT_STYLE_CHANGED, this);
+    lv_obj_add_event_cb(obj, on_card_event, LV_EVENT_DELETE, this);
+    refresh(*card);
+    return true;
+}
+
+int8_t CardLayerCache::acquire_layer(const CardLayerKey& key) {
+    int8_t free_slot = -1;
+    for (uint8_t i = 0; i < MAX_LAYERS; i++) {
+        if (layers[i].users && layers[i].key == key) {
+            layers[i].users++;
+            stats.hits++;
+            return (int8_t)i;
+        }
+        if (!layers[i].users && free_slot < 0) free_slot = (int8_t)i;
+    }
+    if (free_slot < 0) return -1;
+
+    Layer& layer = layers[free_slot];
+    int64_t start = esp_timer_get_time();
+    for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) {
+        CardStripRect rect = card_layer_strip(key, (CardStrip)s);
+        size_t bytes = (size_t)rect.width * rect.height * sizeof(uint16_t);
+        layer.pixels[s] = bytes ? (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) : nullptr;
+        if (bytes && !layer.pixels[s]) {
+            ESP_LOGW(TAG, "PSRAM insuffisante pour une couche %ux%u", key.width, key.height);
+            for (uint8_t k = 0; k < s; k++) {
+                heap_caps_free(layer.pixels[k]);
+                layer.pixels[k] = nullptr;
+            }
+            return -1;
+        }
+        if (bytes) card_layer_render(key, (CardStrip)s, layer.pixels[s]);
+
+        lv_image_dsc_t& dsc = layer.images[s];
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+        dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+        dsc.header.w = rect.width;
+        dsc.header.h = rect.height;
+        dsc.header.stride = rect.width * sizeof(uint16_t);
+        dsc.data_size = bytes;
+        dsc.data = (const uint8_t*)layer.pixels[s];
+    }
+    layer.key = key;
+    layer.users = 1;
+
+    stats.renders++;
+    stats.last_render_us = (uint32_t)(esp_timer_get_time() - start);
+    stats.resident_bytes += card_layer_bytes(key);
+    ESP_LOGI(TAG, "Couche %ux%u rendue en %u us (%u octets)", key.width, key.height,
+             (unsigned)stats.last_render_us, (unsigned)card_layer_bytes(key));
+    return free_slot;
+}
+
+void CardLayerCache::release_layer(int8_t index) {
+    if (index < 0 || index >= MAX_LAYERS || layers[index].users == 0) return;
+    Layer& layer = layers[index];
+    if (--layer.users) return;
+    for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) {
+        heap_caps_free(layer.pixels[s]);
+        layer.pixels[s] = nullptr;
+    }
+    stats.resident_bytes -= card_layer_bytes(layer.key);
+}
+
+void CardLayerCache::set_flat(Card& card, bool flat) {
+    if (card.flat == flat) return;
+    // Mis à jour avant l'appel : le STYLE_CHANGED émis rappelle refresh()
+    card.flat = flat;
+    if (flat) {
+        lv_obj_add_style(card.obj, &flat_style, 0);
+    } else {
+        lv_obj_remove_style(card.obj, &flat_style, 0);
+    }
+}
+
+void CardLayerCache::refresh(Card& card) {
+    lv_obj_t* parent = lv_obj_get_parent(card.obj);
+    CardLayerKey key = {};
+    key.width = (uint16_t)lv_obj_get_width(card.obj);
+    key.height = (uint16_t)lv_obj_get_height(card.obj);
+    key.radius = style.radius;
+    key.shadow_width = style.shadow_width;
+    key.shadow_opa = style.shadow_opa;
+    key.bg_rgb = style.bg_rgb;
+    key.shadow_rgb = style.shadow_rgb;
+    key.backdrop_rgb = parent ? lv_color_to_u32(lv_obj_get_style_bg_color(parent, 0)) & 0xFFFFFF : 0;
+
+    bool usable = enabled && key.width && key.height && key.shadow_width;
+    if (usable && card.layer >= 0 && layers[card.layer].key == key) return;
+
+    int8_t previous = card.layer;
+    card.layer = usable ? acquire_layer(key) : -1;
+    release_layer(previous);
+
+    if (card.layer < 0) {
+        // Pas de couche : les bandes sont masquées et l'ombre LVGL reprend la main
+        for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) {
+            if (card.strips[s]) lv_obj_add_flag(card.strips[s], LV_OBJ_FLAG_HIDDEN);
+        }
+        set_flat(card, false);
+        return;
+    }
+
+    // Positions relatives à la zone de contenu (après le padding)
+    int32_t pad_left = lv_obj_get_style_pad_left(card.obj, 0);
+    int32_t pad_top = lv_obj_get_style_pad_top(card.obj, 0);
+    Layer& layer = layers[card.layer];
+    for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) {
+        if (!card.strips[s]) {
+            card.strips[s] = lv_image_create(card.obj);
+            lv_obj_add_flag(card.strips[s], LV_OBJ_FLAG_FLOATING);
+            lv_obj_add_flag(card.strips[s], LV_OBJ_FLAG_IGNORE_LAYOUT);
+            lv_obj_clear_flag(card.strips[s], LV_OBJ_FLAG_CLICKABLE);
+            lv_obj_move_to_index(card.strips[s], 0); // Dessinées avant les enfants réels
+        }
+        CardStripRect rect = card_layer_strip(key, (CardStrip)s);
+        lv_image_set_src(card.strips[s], &layer.images[s]);
+        lv_obj_set_pos(card.strips[s], rect.x - pad_left, rect.y - pad_top);
+        if (rect.width && rect.height) {
+            lv_obj_clear_flag(card.strips[s], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(card.strips[s], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    set_flat(card, true);
+}
+
+void CardLayerCache::detach(Card& card) {
+    release_layer(card.layer);
+    card.layer = -1;
+    card.obj = nullptr;
+    card.flat = false;
+    for (uint8_t s = 0; s < CARD_STRIP_COUNT; s++) card.strips[s] = nullptr;
+}
+
+void CardLayerCache::on_card_event(lv_event_t* e) {
+    CardLayerCache* cache = static_cast<CardLayerCache*>(lv_event_get_user_data(e));
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+    Card* card = cache->find_card(obj);
+    if (!card) return;
+
+    if (lv_event_get_code(e) == LV_EVENT_DELETE) {
+        // Écran évincé : les bandes partent avec la carte, la couche est libérée
+        cache->detach(*card);
+    } else {
+        cache->refresh(*card);
+    }
+}
+
+void CardLayerCache::set_enabled(bool enable) {
+    if (enable == enabled) return;
+    enabled = enable;
+    for (uint8_t i = 0; i < MAX_CARDS; i++) {
+        if (cards[i].obj) refresh(cards[i]);
+    }
+}
@@ -0,0 +1,87 @@
+#include "include/chart_series.h"
+#include <cstdlib>
+
+ChartSeries::~ChartSeries() {
+    for (uint8_t t = 0; t < TIER_COUNT; t++) free(rings[t]);
+}
+
+bool ChartSeries::init(uint16_t buckets_per_tier) {
+    for (uint8_t t = 0; t < TIER_COUNT; t++) {
+        free(rings[t]);
+        rings[t] = nullptr;
+    }
+    capacity = 0;
+    if (buckets_per_tier == 0) return false;
+
+    for (uint8_t t = 0; t < TIER_COUNT; t++) {
+        rings[t] = (ChartBucket*)malloc(buckets_per_tier * sizeof(ChartBucket));
+        if (!rings[t]) {
+            for (uint8_t k = 0; k < t; k++) {
+                free(rings[k]);
+                rings[k] = nullptr;
+            }
+            return false;
+        }
+    }
+    capacity = buckets_per_tier;
+    clear();
+    return true;
+}
+
+void ChartSeries::clear() {
+    for (uint8_t t = 0; t < TIER_COUNT; t++) {
+        completed[t] = 0;
+        pending_count[t] = 0;
+    }
+}
+
+void ChartSeries::push(uint8_t tier, ChartBucket bucket) {
+    rings[tier][completed[tier] % capacity] = bucket;
+    completed[tier]++;
+    if (tier + 1 >= TIER_COUNT) return;
+
+    // Propagation vers le palier supérieur
+    uint8_t up = tier + 1;
+    if (pending_count[up] == 0) {
+        pending[up] = bucket;
+    } else {
+        if (bucket.min < pending[up].min) pending[up].min = bucket.min;
+        if (bucket.max > pending[up].max) pending[up].max = bucket.max;
+    }
+    if (++pending_count[up] == TIER_FACTOR) {
+        pending_count[up] = 0;
+        push(up, pending[up]);
+    }
+}
+
+void ChartSeries::append(int16_t value) {
+    if (!capacity) return;
+    push(0, {value, value});
+}
+
+uint32_t ChartSeries::samples_per_bucket(uint8_t tier) {
+    uint32_t samples = 1;
+    for (uint8_t t = 0; t < tier; t++) samples *= TIER_FACTOR;
+    return samples;
+}
+
+uint16_t ChartSeries::stored(uint8_t tier) const {
+    if (tier >= TIER_COUNT) return 0;
+    return completed[tier] < capacity ? (uint16_t)completed[tier] : capacity;
+}
+
+ChartBucket ChartSeries::bucket(uint8_t tier, uint32_t sequence) const {
+    if (tier >= TIER_COUNT || !capacity || sequence >= completed[tier] ||
+        completed[tier] - sequence > capacity) {
+        return {0, 0};
+    }
+    return rings[tier][sequence % capacity];
+}
+
+uint8_t ChartSeries::tier_for_span(uint32_t span_samples, uint16_t columns) {
+    if (!columns) return TIER_COUNT - 1;
+    for (uint8_t t = 0; t < TIER_COUNT; t++) {
+        if ((uint64_t)samples_per_bucket(t) * columns >= span_samples) return t;
+    }
+    return TIER_COUNT - 1;
+}
@@ -0,0 +1,100 @@
+#include "include/crc32c.h"
+#include <array>
+#include <cstring>
+
+#if !defined(ESP_PLATFORM) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC32C_HAVE_SSE42 1
+#include <nmmintrin.h>
+#endif
+
+#define CRC32C_POLY 0x82F63B78u
+
+using Crc32cTables = std::array<std::array<uint32_t, 256>, 8>;
+
+// Tables générées à la compilation (8 Ko en flash sur cible)
+static constexpr Crc32cTables make_tables() {
+    Crc32cTables tables{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (CRC32C_POLY & (0u - (crc & 1u)));
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int t = 1; t < 8; t++) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+    }
+    return tables;
+}
+
+static constexpr Crc32cTables CRC32C_TABLES = make_tables();
+
+static uint32_t crc32c_sw(const uint8_t* p, size_t size, uint32_t crc) {
+    const auto& t = CRC32C_TABLES;
+
+    while (size && (reinterpret_cast<uintptr_t>(p) & 3)) {
+        crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+        size--;
+    }
+    while (size >= 8) {
+        uint32_t lo, hi;
+        memcpy(&lo, p, 4);
+        memcpy(&hi, p + 4, 4);
+        lo ^= crc;
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^
+              t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+              t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef CRC32C_HAVE_SSE42
+static bool force_software = false;
+
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_sse42(const uint8_t* p, size_t size, uint32_t crc) {
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        p += 8;
+        size -= 8;
+    }
+    crc = static_cast<uint32_t>(crc64);
+#endif
+    while (size--) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+#endif
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+#ifdef CRC32C_HAVE_SSE42
+    static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+    if (has_sse42 && !force_software) {
+        return ~crc32c_sse42(p, size, crc);
+    }
+#endif
+    return ~crc32c_sw(p, size, crc);
+}
+
+void crc32c_force_software(bool force) {
+#ifdef CRC32C_HAVE_SSE42
+    force_software = force;
+#else
+    (void)force;
+#endif
+}
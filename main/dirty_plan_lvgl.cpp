@@ -0,0 +1,27 @@
+#include "include/dirty_plan_lvgl.h"
+#include "src/display/lv_display_private.h"
+
+bool plan_display_areas(lv_display_t* display, const DirtyPlanner* planner, DirtyPlanner::Result& result) {
+    // Mise en page anticipée : les invalidations qu'elle produit font partie du plan
+    // (LVGL la refait juste après, sans travail restant)
+    lv_obj_update_layout(display->act_scr);
+    lv_obj_update_layout(display->top_layer);
+    lv_obj_update_layout(display->sys_layer);
+
+    result = {};
+    result.areas_in = result.areas_out = (uint16_t)display->inv_p;
+    if (!planner || display->inv_p <= 1) return false;
+
+    DirtyRect rects[LV_INV_BUF_SIZE];
+    for (uint32_t i = 0; i < display->inv_p; i++) {
+        const lv_area_t& a = display->inv_areas[i];
+        rects[i] = {a.x1, a.y1, a.x2, a.y2};
+    }
+    result = planner->plan(rects, display->inv_p);
+    for (uint16_t i = 0; i < result.areas_out; i++) {
+        lv_area_set(&display->inv_areas[i], rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2);
+        display->inv_area_joined[i] = 0;
+    }
+    display->inv_p = result.areas_out;
+    return true;
+}
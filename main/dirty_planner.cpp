@@ -0,0 +1,61 @@
+#include "include/dirty_planner.h"
+
+void DirtyPlanner::configure(int32_t screen_width, int32_t screen_height, const CostModel& cost_model) {
+    width = screen_width;
+    height = screen_height;
+    model = cost_model;
+    if (model.align_px == 0) model.align_px = 1;
+    if (model.max_areas == 0) model.max_areas = 1;
+}
+
+uint32_t DirtyPlanner::area(const DirtyRect& rect) {
+    if (rect.x2 < rect.x1 || rect.y2 < rect.y1) return 0;
+    return (uint32_t)(rect.x2 - rect.x1 + 1) * (uint32_t)(rect.y2 - rect.y1 + 1);
+}
+
+DirtyRect DirtyPlanner::join(const DirtyRect& a, const DirtyRect& b) {
+    return {a.x1 < b.x1 ? a.x1 : b.x1, a.y1 < b.y1 ? a.y1 : b.y1,
+            a.x2 > b.x2 ? a.x2 : b.x2, a.y2 > b.y2 ? a.y2 : b.y2};
+}
+
+DirtyPlanner::Result DirtyPlanner::plan(DirtyRect* rects, size_t count) const {
+    Result result = {};
+    result.areas_in = (uint16_t)count;
+
+    // Alignement : une ligne de zone commence et finit sur une frontière de rafale
+    int32_t mask = model.align_px - 1;
+    for (size_t i = 0; i < count; i++) {
+        DirtyRect& r = rects[i];
+        result.requested_px += area(r);
+        r.x1 &= ~mask;
+        r.x2 |= mask;
+        if (r.x1 < 0) r.x1 = 0;
+        if (r.y1 < 0) r.y1 = 0;
+        if (width && r.x2 >= width) r.x2 = width - 1;
+        if (height && r.y2 >= height) r.y2 = height - 1;
+    }
+
+    // Fusion gloutonne de la paire la moins chère : pixels ajoutés contre un flush
+    // évité ; au-delà du plafond, la fusion est imposée même si elle coûte
+    while (count > 1) {
+        size_t best_i = 0, best_j = 1;
+        int64_t best_cost = INT64_MAX;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = i + 1; j < count; j++) {
+                int64_t cost = (int64_t)area(join(rects[i], rects[j])) - area(rects[i]) - area(rects[j]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        if (best_cost > (int64_t)model.flush_overhead_px && count <= model.max_areas) break;
+        rects[best_i] = join(rects[best_i], rects[best_j]);
+        rects[best_j] = rects[--count];
+    }
+
+    result.areas_out = (uint16_t)count;
+    for (size_t i = 0; i < count; i++) result.flushed_px += area(rects[i]);
+    return result;
+}
@@ -1,24 +1,62 @@
 #include "include/display_driver.h"
+#include "include/dirty_plan_lvgl.h"
 #include "esp_lcd_panel_rgb.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_heap_caps.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
 #include <cstring>
 
 static const char* TAG = "DisplayDriver";
 
+// Porches du panneau Waveshare 7" (communs à tous les profils)
+#define LCD_HSYNC_PULSE     10
+#define LCD_HSYNC_BACK      20
+#define LCD_HSYNC_FRONT     10
+#define LCD_VSYNC_PULSE     2
+#define LCD_VSYNC_BACK      8
+#define LCD_VSYNC_FRONT     4
+
+// Les tampons de rebond doivent diviser le framebuffer : 600 lignes / 10 et / 20
+static const LcdTimingProfile lcd_profiles[] = {
+    {"sûr",       12000000, 0},
+    {"équilibré", 16000000, 10},
+    {"rapide",    21000000, 20},
+};
+
 #define CH422_ADDR 0x40
 #define FT5X06_ADDR 0x38
 
-static esp_err_t exio_set_level(uint8_t exio, int level) {
-    uint8_t cmd[2] = { static_cast<uint8_t>(0x70 | ((exio & 0x06) << 1)),
-                       static_cast<uint8_t>(level ? (1 << (exio & 0x07)) : 0) };
-    return i2c_master_write_to_device(I2C_NUM_0, CH422_ADDR, cmd, sizeof(cmd), pdMS_TO_TICKS(100));
+#define TOUCH_I2C_HZ            400000
+#define TOUCH_POLL_MS           20      // Sans interruption : scrutation
+#define TOUCH_RELEASE_POLL_MS   50      // Doigt posé : relecture si la levée n'interrompt pas
+#define TOUCH_LATENCY_MAX_US    250000  // Entrée sans rendu associé : non comptée
+
+#define I2C_XFER_TIMEOUT_MS     20      // Une rafale tactile dure ~1 ms à 400 kHz
+
+// Bus partagé, servi par sa propre tâche
+I2cBus DisplayDriver::i2c_bus;
+uint8_t DisplayDriver::touch_dev = I2C_NO_DEVICE;
+uint8_t DisplayDriver::expander_dev = I2C_NO_DEVICE;
+
+static void exio_command(uint8_t exio, int level, uint8_t* cmd) {
+    cmd[0] = static_cast<uint8_t>(0x70 | ((exio & 0x06) << 1));
+    cmd[1] = static_cast<uint8_t>(level ? (1 << (exio & 0x07)) : 0);
 }
 
-static esp_err_t ft5x06_read(uint8_t reg, uint8_t* data, size_t len) {
-    return i2c_master_write_read_device(I2C_NUM_0, FT5X06_ADDR, &reg, 1, data, len, pdMS_TO_TICKS(100));
+// Initialisation seulement : l'ordre et les délais du reset doivent être tenus
+bool DisplayDriver::exio_set_level(uint8_t exio, int level) {
+    uint8_t cmd[2];
+    exio_command(exio, level, cmd);
+    return i2c_bus.transfer(expander_dev, cmd, sizeof(cmd), nullptr, 0, I2cPriority::EXPANDER) == I2cStatus::OK;
+}
+
+bool DisplayDriver::exio_set_level_async(uint8_t exio, int level) {
+    uint8_t cmd[2];
+    exio_command(exio, level, cmd);
+    return i2c_bus.write_async(expander_dev, cmd, sizeof(cmd), I2cPriority::EXPANDER);
 }
 
 // Buffers LVGL statiques
@@ -26,26 +64,85 @@ lv_display_t* DisplayDriver::lvgl_display = nullptr;
 lv_color_t* DisplayDriver::buf1 = nullptr;
 lv_color_t* DisplayDriver::buf2 = nullptr;
 lv_indev_t* DisplayDriver::touch_indev = nullptr;
+SemaphoreHandle_t DisplayDriver::vsync_sem = nullptr;
+bool DisplayDriver::swap_pending = false;
+QueueHandle_t DisplayDriver::flush_queue = nullptr;
+SemaphoreHandle_t DisplayDriver::flush_done_sem = nullptr;
+int64_t DisplayDriver::copy_start_us = 0;
+std::atomic<uint32_t> DisplayDriver::flush_count{0};
+std::atomic<uint32_t> DisplayDriver::flush_bytes{0};
+std::atomic<uint32_t> DisplayDriver::swap_count{0};
+std::atomic<uint32_t> DisplayDriver::frame_count{0};
+std::atomic<uint32_t> DisplayDriver::copy_us{0};
+std::atomic<uint32_t> DisplayDriver::wait_us{0};
+std::atomic<uint32_t> DisplayDriver::vsync_timeouts{0};
+DirtyPlanner DisplayDriver::planner;
+std::atomic<uint32_t> DisplayDriver::planned_frames{0};
+std::atomic<uint32_t> DisplayDriver::planned_areas_in{0};
+std::atomic<uint32_t> DisplayDriver::planned_areas_out{0};
+std::atomic<uint32_t> DisplayDriver::requested_px{0};
+std::atomic<uint32_t> DisplayDriver::planned_px{0};
+TouchRing DisplayDriver::touch_ring;
+GestureDetector DisplayDriver::gestures;
+TaskHandle_t DisplayDriver::touch_task_handle = nullptr;
+bool DisplayDriver::touch_irq_enabled = false;
+std::atomic<uint32_t> DisplayDriver::touch_irq_us{0};
+TouchSample DisplayDriver::touch_state = {};
+GestureCallback DisplayDriver::gesture_cb = nullptr;
+void* DisplayDriver::gesture_ctx = nullptr;
+TaskHandle_t DisplayDriver::input_task = nullptr;
+bool DisplayDriver::swallow_touch = false;
+uint32_t DisplayDriver::pending_input_us = 0;
+bool DisplayDriver::input_pending = false;
+std::atomic<uint32_t> DisplayDriver::touch_irqs{0};
+std::atomic<uint32_t> DisplayDriver::touch_reads{0};
+std::atomic<uint32_t> DisplayDriver::touch_errors{0};
+std::atomic<uint32_t> DisplayDriver::touch_gestures{0};
+std::atomic<uint32_t> DisplayDriver::latency_count{0};
+std::atomic<uint32_t> DisplayDriver::latency_sum_us{0};
+std::atomic<uint32_t> DisplayDriver::latency_max_us{0};
+std::atomic<uint32_t> DisplayDriver::invalidated_areas{0};
+std::atomic<uint32_t> DisplayDriver::render_count{0};
+std::atomic<uint32_t> DisplayDriver::render_us{0};
+int64_t DisplayDriver::render_start_us = 0;
+
+DisplayDriver::DisplayDriver(RenderMode mode, LcdProfile profile)
+    : panel_handle(nullptr), render_mode(mode), lcd_profile(profile) {
+}
 
-DisplayDriver::DisplayDriver() : panel_handle(nullptr) {
+const LcdTimingProfile& DisplayDriver::get_timing_profile(LcdProfile profile) {
+    return lcd_profiles[(uint8_t)profile];
+}
+
+float DisplayDriver::get_refresh_hz(LcdProfile profile) {
+    uint32_t line = LCD_WIDTH + LCD_HSYNC_PULSE + LCD_HSYNC_BACK + LCD_HSYNC_FRONT;
+    uint32_t frame = LCD_HEIGHT + LCD_VSYNC_PULSE + LCD_VSYNC_BACK + LCD_VSYNC_FRONT;
+    return (float)get_timing_profile(profile).pclk_hz / (float)(line * frame);
 }
 
 DisplayDriver::~DisplayDriver() {
     if (panel_handle) {
         esp_lcd_panel_del(panel_handle);
     }
+    // Tampons LVGL du mode PARTIAL seulement : les framebuffers appartiennent au panneau
     if (buf1) {
         heap_caps_free(buf1);
     }
     if (buf2) {
         heap_caps_free(buf2);
     }
+    if (vsync_sem) {
+        vSemaphoreDelete(vsync_sem);
+    }
 }
 
 bool DisplayDriver::initialize() {
     ESP_LOGI(TAG, "Initialisation du pilote d'affichage Waveshare ESP32-S3 7\"");
 
     lv_init();
+    // Horloge LVGL : sans elle, lv_tick_get() reste à 0 et les échéances des
+    // minuteries (cadence de la tâche UI) ne progressent jamais
+    lv_tick_set_cb(lvgl_tick_cb);
 
     if (!configure_touch_interface()) {
         ESP_LOGE(TAG, "Échec configuration tactile");
@@ -84,15 +181,15 @@ bool DisplayDriver::configure_lcd_interface() {
     panel_config.bits_per_pixel    = 16;
     panel_config.clk_src           = LCD_CLK_SRC_DEFAULT;
     panel_config.timings           = {
-        .pclk_hz         = 12000000,
+        .pclk_hz         = get_timing_profile(lcd_profile).pclk_hz,
         .h_res           = LCD_WIDTH,
         .v_res           = LCD_HEIGHT,
-        .hsync_pulse_width = 10,
-        .hsync_back_porch  = 20,
-        .hsync_front_porch = 10,
-        .vsync_pulse_width = 2,
-        .vsync_back_porch  = 8,
-        .vsync_front_porch = 4,
+        .hsync_pulse_width = LCD_HSYNC_PULSE,
+        .hsync_back_porch  = LCD_HSYNC_BACK,
+        .hsync_front_porch = LCD_HSYNC_FRONT,
+        .vsync_pulse_width = LCD_VSYNC_PULSE,
+        .vsync_back_porch  = LCD_VSYNC_BACK,
+        .vsync_front_porch = LCD_VSYNC_FRONT,
         .flags = {
             .hsync_idle_low   = 0,
             .vsync_idle_low   = 0,
@@ -105,11 +202,46 @@ bool DisplayDriver::configure_lcd_interface() {
     panel_config.de_gpio_num       = LCD_PIN_DE;
     panel_config.pclk_gpio_num     = LCD_PIN_PCLK;
     panel_config.disp_gpio_num     = -1;
-    panel_config.num_fbs           = 1;
-    panel_config.bounce_buffer_size_px = 0;
+    panel_config.num_fbs           = render_mode == RenderMode::DIRECT ? 2 : 1;
+    // Tampons de rebond en SRAM interne (deux moitiés alternées, remplies par le CPU)
+    panel_config.bounce_buffer_size_px = LCD_WIDTH * get_timing_profile(lcd_profile).bounce_lines;
     panel_config.flags.fb_in_psram = 1;
 
-    ESP_ERROR_CHECK(esp_lcd_new_rgb_panel(&panel_config, &panel_handle));
+    esp_err_t err = esp_lcd_new_rgb_panel(&panel_config, &panel_handle);
+    if (err != ESP_OK && render_mode == RenderMode::DIRECT) {
+        // Deux framebuffers de 1,2 Mo : repli sur le mode partiel si la PSRAM
+        // manque, sans toucher au profil (les tampons de rebond sont en SRAM)
+        ESP_LOGW(TAG, "Double framebuffer impossible (%s), repli en mode partiel", esp_err_to_name(err));
+        render_mode = RenderMode::PARTIAL;
+        panel_config.num_fbs = 1;
+        err = esp_lcd_new_rgb_panel(&panel_config, &panel_handle);
+    }
+    if (err != ESP_OK && lcd_profile != LcdProfile::SAFE) {
+        // Horloge élevée impossible sans tampon de rebond : retour au profil d'origine
+        ESP_LOGW(TAG, "Profil LCD %s impossible (%s), repli sur le profil %s",
+                 get_timing_profile(lcd_profile).name, esp_err_to_name(err), get_timing_profile(LcdProfile::SAFE).name);
+        lcd_profile = LcdProfile::SAFE;
+        panel_config.timings.pclk_hz = get_timing_profile(lcd_profile).pclk_hz;
+        panel_config.bounce_buffer_size_px = 0;
+        err = esp_lcd_new_rgb_panel(&panel_config, &panel_handle);
+    }
+    ESP_ERROR_CHECK(err);
+    const LcdTimingProfile& profile = get_timing_profile(lcd_profile);
+    ESP_LOGI(TAG, "Profil LCD %s: PCLK %u MHz, %u lignes de rebond, %.1f Hz théoriques",
+             profile.name, (unsigned)(profile.pclk_hz / 1000000), profile.bounce_lines,
+             get_refresh_hz(lcd_profile));
+
+    // VSYNC : décompte des images balayées, et échange des tampons en mode DIRECT
+    if (render_mode == RenderMode::DIRECT) {
+        vsync_sem = xSemaphoreCreateBinary();
+    }
+    esp_lcd_rgb_panel_event_callbacks_t callbacks = {};
+    callbacks.on_vsync = on_vsync;
+    if (render_mode == RenderMode::PARTIAL) {
+        // Fin de copie vers le framebuffer : libère le tampon LVGL
+        callbacks.on_color_trans_done = on_color_trans_done;
+    }
+    ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &callbacks, this));
     ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
@@ -117,17 +249,14 @@ bool DisplayDriver::configure_lcd_interface() {
 }
 
 bool DisplayDriver::configure_touch_interface() {
-    i2c_config_t i2c_conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = TOUCH_SDA_PIN,
-        .scl_io_num = TOUCH_SCL_PIN,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master = { .clk_speed = 100000 },
-        .clk_flags = 0,
-    };
-    ESP_ERROR_CHECK(i2c_param_config(I2C_NUM_0, &i2c_conf));
-    ESP_ERROR_CHECK(i2c_driver_install(I2C_NUM_0, i2c_conf.mode, 0, 0, 0));
+    if (!i2c_bus.begin(I2C_NUM_0, TOUCH_SDA_PIN, TOUCH_SCL_PIN, I2C_XFER_TIMEOUT_MS)) {
+        return false;
+    }
+    touch_dev = i2c_bus.add_device(FT5X06_ADDR, TOUCH_I2C_HZ, "tactile");
+    expander_dev = i2c_bus.add_device(CH422_ADDR, TOUCH_I2C_HZ, "expander");
+    if (touch_dev == I2C_NO_DEVICE || expander_dev == I2C_NO_DEVICE) {
+        return false;
+    }
 
     // Reset du contrôleur tactile via l'expander
     exio_set_level(TOUCH_RST_EXIO, 0);
@@ -137,12 +266,37 @@ bool DisplayDriver::configure_touch_interface() {
 
     uint8_t reg = 0xA8; // registre ID
     uint8_t id = 0;
-    if (ft5x06_read(reg, &id, 1) != ESP_OK) {
+    if (i2c_bus.transfer(touch_dev, &reg, 1, &id, 1, I2cPriority::TOUCH) != I2cStatus::OK) {
         ESP_LOGE(TAG, "FT5x06 non détecté");
         return false;
     }
     ESP_LOGI(TAG, "Contrôleur tactile ID: 0x%02X", id);
 
+    // Lecture I2C hors de la tâche UI, sur le cœur 0
+    if (xTaskCreatePinnedToCore(touch_task, "Touch", 3072, this, 4, &touch_task_handle, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Tâche tactile impossible");
+        return false;
+    }
+
+    // INT actif bas : un front descendant par rapport du contrôleur
+    gpio_config_t int_conf = {};
+    int_conf.pin_bit_mask = 1ULL << TOUCH_INT_PIN;
+    int_conf.mode = GPIO_MODE_INPUT;
+    int_conf.pull_up_en = GPIO_PULLUP_ENABLE;
+    int_conf.intr_type = GPIO_INTR_NEGEDGE;
+    esp_err_t err = gpio_config(&int_conf);
+    if (err == ESP_OK) {
+        err = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+        if (err == ESP_ERR_INVALID_STATE) err = ESP_OK;     // Service déjà installé
+    }
+    if (err == ESP_OK) err = gpio_isr_handler_add(TOUCH_INT_PIN, touch_isr, nullptr);
+    touch_irq_enabled = err == ESP_OK;
+    if (!touch_irq_enabled) {
+        ESP_LOGW(TAG, "Interruption tactile indisponible (%s), scrutation toutes les %d ms",
+                 esp_err_to_name(err), TOUCH_POLL_MS);
+    }
+    xTaskNotifyGive(touch_task_handle);     // État initial
+
     touch_indev = lv_indev_create();
     lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(touch_indev, lvgl_touch_cb);
@@ -151,7 +305,86 @@ bool DisplayDriver::configure_touch_interface() {
     return true;
 }
 
+void IRAM_ATTR DisplayDriver::touch_isr(void* arg) {
+    touch_irq_us.store((uint32_t)esp_timer_get_time(), std::memory_order_relaxed);
+    touch_irqs.fetch_add(1, std::memory_order_relaxed);
+    BaseType_t high_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touch_task_handle, &high_task_woken);
+    portYIELD_FROM_ISR(high_task_woken);
+}
+
+void DisplayDriver::touch_task(void* arg) {
+    uint8_t regs[FT5X06_BURST_BYTES];
+    bool touching = false;
+    while (true) {
+        TickType_t wait = !touch_irq_enabled ? pdMS_TO_TICKS(TOUCH_POLL_MS)
+                          : touching         ? pdMS_TO_TICKS(TOUCH_RELEASE_POLL_MS)
+                                             : portMAX_DELAY;
+        bool notified = ulTaskNotifyTake(pdTRUE, wait) != 0;
+        uint32_t irq_us = notified && touch_irq_enabled ? touch_irq_us.load(std::memory_order_relaxed)
+                                                        : (uint32_t)esp_timer_get_time();
+
+        // Tous les points en une rafale depuis TD_STATUS, en tête de file du bus
+        uint8_t reg = FT5X06_REG_TD_STATUS;
+        if (i2c_bus.transfer(touch_dev, &reg, 1, regs, sizeof(regs), I2cPriority::TOUCH) != I2cStatus::OK) {
+            touch_errors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        touch_reads.fetch_add(1, std::memory_order_relaxed);
+
+        TouchSample sample;
+        if (!ft5x06_parse(regs, irq_us, sample)) continue;
+        // Scrutation sans changement : rien à publier
+        if (!notified && !touching && sample.count == 0) continue;
+        touching = sample.count > 0;
+        touch_ring.push(sample);
+        if (input_task) xTaskNotifyGive(input_task);
+    }
+}
+
 bool DisplayDriver::configure_lvgl() {
+    lvgl_display = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+    lv_display_set_flush_cb(lvgl_display, lvgl_flush_cb);
+
+    if (render_mode == RenderMode::DIRECT) {
+        // LVGL rend directement dans le framebuffer en retrait ; en mode DIRECT
+        // à deux tampons, il recopie lui-même les zones du rendu précédent
+        // dans l'autre framebuffer avant de dessiner (synchronisation des zones)
+        void* fb0 = nullptr;
+        void* fb1 = nullptr;
+        ESP_ERROR_CHECK(esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 2, &fb0, &fb1));
+        lv_display_set_buffers(lvgl_display, fb0, fb1, LCD_WIDTH * LCD_HEIGHT * (LCD_BIT_PER_PIXEL / 8),
+                               LV_DISPLAY_RENDER_MODE_DIRECT);
+        // Attente du VSYNC seulement quand LVGL réclame l'ancien tampon
+        lv_display_set_flush_wait_cb(lvgl_display, lvgl_vsync_wait_cb);
+        ESP_LOGI(TAG, "Rendu direct dans deux framebuffers, échange au VSYNC");
+    } else if (!configure_partial_buffers()) {
+        return false;
+    }
+
+    lv_display_set_user_data(lvgl_display, this);
+
+    // Coût fixe d'une zone : préparation du rendu, et en mode partiel appel de
+    // draw_bitmap et copie à pas variable en PSRAM. Bords alignés sur 32 px
+    // (64 octets : une ligne de cache, deux rafales PSRAM de 32 octets)
+    DirtyPlanner::CostModel model;
+    model.flush_overhead_px = render_mode == RenderMode::PARTIAL ? 6144 : 2048;
+    model.align_px = 32;
+    model.max_areas = 8;
+    planner.configure(LCD_WIDTH, LCD_HEIGHT, model);
+    lv_display_add_event_cb(lvgl_display, lvgl_refr_start_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(lvgl_display, lvgl_render_event_cb, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(lvgl_display, lvgl_render_event_cb, LV_EVENT_RENDER_START, nullptr);
+    lv_display_add_event_cb(lvgl_display, lvgl_render_event_cb, LV_EVENT_RENDER_READY, nullptr);
+
+    if (touch_indev) {
+        lv_indev_set_display(touch_indev, lvgl_display);
+    }
+
+    return true;
+}
+
+bool DisplayDriver::configure_partial_buffers() {
     // Allocation des buffers
     size_t buffer_size = LCD_WIDTH * 60; // 60 lignes de buffer
     buf1 = (lv_color_t*)heap_caps_malloc(
@@ -176,58 +409,260 @@ bool DisplayDriver::configure_lvgl() {
         }
         buffer_size = small_size;
     }
-    
-    // Création du display LVGL
-    lvgl_display = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
-    lv_display_set_flush_cb(lvgl_display, lvgl_flush_cb);
+
     lv_display_set_buffers(lvgl_display, buf1, buf2, buffer_size * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
-    lv_display_set_user_data(lvgl_display, this);
 
-    if (touch_indev) {
-        lv_indev_set_display(touch_indev, lvgl_display);
+    // Tâche de copie sur le cœur 0, la tâche UI restant sur le cœur 1 ;
+    // sans elle, la copie reste synchrone dans lvgl_flush_cb. Priorité 3 :
+    // au-dessus du thread de dessin LVGL du cœur 0 (LV_OS_ESP_CORE0_MAX_PRIO)
+    flush_done_sem = xSemaphoreCreateBinary();
+    flush_queue = xQueueCreate(1, sizeof(FlushJob));
+    if (flush_done_sem && flush_queue &&
+        xTaskCreatePinnedToCore(flush_task, "LcdFlush", 3072, this, 3, nullptr, 0) == pdPASS) {
+        lv_display_set_flush_wait_cb(lvgl_display, lvgl_flush_wait_cb);
+    } else {
+        ESP_LOGW(TAG, "Copie asynchrone indisponible, copie synchrone");
+        if (flush_queue) vQueueDelete(flush_queue);
+        flush_queue = nullptr;
     }
-
     return true;
 }
 
+bool IRAM_ATTR DisplayDriver::on_vsync(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t* edata,
+                                       void* user_ctx) {
+    frame_count.fetch_add(1, std::memory_order_relaxed);
+    if (!vsync_sem) return false;
+    BaseType_t high_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(vsync_sem, &high_task_woken);
+    return high_task_woken == pdTRUE;
+}
+
 void DisplayDriver::lvgl_flush_cb(lv_display_t* display, const lv_area_t* area, uint8_t* color_map) {
     DisplayDriver* driver = static_cast<DisplayDriver*>(lv_display_get_user_data(display));
+    if (lv_display_flush_is_last(display)) record_input_latency();
+
+    if (driver->render_mode == RenderMode::DIRECT) {
+        // Pixels déjà en place : seule la dernière zone de l'image déclenche l'échange
+        flush_count.fetch_add(1, std::memory_order_relaxed);
+        if (lv_display_flush_is_last(display)) {
+            // Un framebuffer du panneau passé à draw_bitmap devient le tampon balayé
+            // à la fin de l'image en cours, sans copie. L'ancien tampon n'est rendu
+            // à LVGL qu'au VSYNC, dans lvgl_vsync_wait_cb : la mise à jour de
+            // l'interface qui suit recouvre la fin du balayage
+            xSemaphoreTake(vsync_sem, 0);
+            esp_lcd_panel_draw_bitmap(driver->panel_handle, 0, 0, LCD_WIDTH, LCD_HEIGHT, color_map);
+            swap_pending = true;
+            return;
+        }
+        lv_display_flush_ready(display);
+        return;
+    }
     
-    int offsetx1 = area->x1;
-    int offsetx2 = area->x2;
-    int offsety1 = area->y1;
-    int offsety2 = area->y2;
-    
-    esp_lcd_panel_draw_bitmap(driver->panel_handle, offsetx1, offsety1, 
-                             offsetx2 + 1, offsety2 + 1, color_map);
-    
-    lv_display_flush_ready(display);
+    uint32_t pixels = (uint32_t)lv_area_get_width(area) * (uint32_t)lv_area_get_height(area);
+    flush_count.fetch_add(1, std::memory_order_relaxed);
+    flush_bytes.fetch_add(pixels * (LCD_BIT_PER_PIXEL / 8), std::memory_order_relaxed);
+
+    FlushJob job = {*area, color_map};
+    if (flush_queue) {
+        // Fin de copie signalée par flush_done_sem seul, consommé par
+        // lvgl_flush_wait_cb avant que LVGL ne réutilise le tampon
+        xQueueSend(flush_queue, &job, portMAX_DELAY);
+        return;
+    }
+    driver->copy_area(job);
+}
+
+void DisplayDriver::copy_area(const FlushJob& job) {
+    // Copie CPU vers le framebuffer ; fin signalée par on_color_trans_done
+    copy_start_us = esp_timer_get_time();
+    esp_lcd_panel_draw_bitmap(panel_handle, job.area.x1, job.area.y1,
+                              job.area.x2 + 1, job.area.y2 + 1, job.color_map);
+}
+
+void DisplayDriver::flush_task(void* arg) {
+    DisplayDriver* driver = static_cast<DisplayDriver*>(arg);
+    FlushJob job;
+    while (true) {
+        if (xQueueReceive(flush_queue, &job, portMAX_DELAY) == pdTRUE) {
+            driver->copy_area(job);
+        }
+    }
+}
+
+bool DisplayDriver::on_color_trans_done(esp_lcd_panel_handle_t panel, void* user_ctx) {
+    copy_us.fetch_add((uint32_t)(esp_timer_get_time() - copy_start_us), std::memory_order_relaxed);
+    // Un seul signal par copie : avec lvgl_flush_wait_cb, LVGL considère le
+    // tampon libre au retour de l'attente, sans lv_display_flush_ready. Un
+    // second signal laisserait l'attente suivante passer pendant une copie.
+    if (flush_queue) {
+        xSemaphoreGive(flush_done_sem);
+    } else {
+        lv_display_flush_ready(lvgl_display);
+    }
+    return false;
+}
+
+void DisplayDriver::lvgl_flush_wait_cb(lv_display_t* display) {
+    // LVGL réclame un tampon encore en copie : seul ce temps n'est pas recouvert
+    int64_t start = esp_timer_get_time();
+    // Le tampon n'est rendu qu'après la copie : un délai dépassé est signalé, pas ignoré
+    while (xSemaphoreTake(flush_done_sem, pdMS_TO_TICKS(100)) != pdTRUE) {
+        ESP_LOGW(TAG, "Copie vers le framebuffer toujours en cours après 100 ms");
+    }
+    wait_us.fetch_add((uint32_t)(esp_timer_get_time() - start), std::memory_order_relaxed);
+}
+
+void DisplayDriver::lvgl_vsync_wait_cb(lv_display_t* display) {
+    if (!swap_pending) return;
+    // Tant que le VSYNC n'est pas venu, l'ancien tampon peut encore être balayé
+    int64_t start = esp_timer_get_time();
+    while (xSemaphoreTake(vsync_sem, pdMS_TO_TICKS(100)) != pdTRUE) {
+        vsync_timeouts.fetch_add(1, std::memory_order_relaxed);
+        ESP_LOGW(TAG, "VSYNC absent depuis 100 ms, tampon conservé");
+    }
+    swap_pending = false;
+    swap_count.fetch_add(1, std::memory_order_relaxed);
+    wait_us.fetch_add((uint32_t)(esp_timer_get_time() - start), std::memory_order_relaxed);
+}
+
+void DisplayDriver::lvgl_refr_start_cb(lv_event_t* e) {
+    lv_display_t* display = static_cast<lv_display_t*>(lv_event_get_current_target(e));
+    DirtyPlanner::Result result;
+    if (!plan_display_areas(display, &planner, result)) return;
+
+    planned_frames.fetch_add(1, std::memory_order_relaxed);
+    planned_areas_in.fetch_add(result.areas_in, std::memory_order_relaxed);
+    planned_areas_out.fetch_add(result.areas_out, std::memory_order_relaxed);
+    requested_px.fetch_add(result.requested_px, std::memory_order_relaxed);
+    planned_px.fetch_add(result.flushed_px, std::memory_order_relaxed);
+}
+
+void DisplayDriver::lvgl_render_event_cb(lv_event_t* e) {
+    // Coût de rendu par zone invalidée : compare ombres LVGL et couches en cache
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_INVALIDATE_AREA:
+            invalidated_areas.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case LV_EVENT_RENDER_START:
+            render_start_us = esp_timer_get_time();
+            break;
+        case LV_EVENT_RENDER_READY:
+            render_count.fetch_add(1, std::memory_order_relaxed);
+            render_us.fetch_add((uint32_t)(esp_timer_get_time() - render_start_us), std::memory_order_relaxed);
+            break;
+        default:
+            break;
+    }
+}
+
+uint32_t DisplayDriver::lvgl_tick_cb() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
 }
 
 void DisplayDriver::lvgl_touch_cb(lv_indev_t* indev, lv_indev_data_t* data) {
-    uint8_t buf[5];
-    if (ft5x06_read(0x02, buf, sizeof(buf)) == ESP_OK) {
-        uint8_t touches = buf[0] & 0x0F;
-        if (touches) {
-            uint16_t x = ((buf[1] & 0x0F) << 8) | buf[2];
-            uint16_t y = ((buf[3] & 0x0F) << 8) | buf[4];
-            data->state = LV_INDEV_STATE_PRESSED;
-            data->point.x = x;
-            data->point.y = y;
-            return;
+    // Aucun accès I2C ici : seulement les échantillons déjà lus
+    TouchSample sample;
+    while (touch_ring.pop(sample)) {
+        // Toucher de réveil : ignoré jusqu'au relâchement
+        if (swallow_touch) {
+            if (sample.count == 0) swallow_touch = false;
+            continue;
+        }
+        TouchGesture gesture;
+        if (gestures.feed(sample, gesture)) {
+            touch_gestures.fetch_add(1, std::memory_order_relaxed);
+            if (gesture_cb) gesture_cb(gesture_ctx, gesture);
+        }
+        if (!input_pending) {
+            pending_input_us = sample.irq_us;
+            input_pending = true;
         }
+        // Au relâchement, les points précédents restent : LVGL attend la dernière position
+        touch_state.irq_us = sample.irq_us;
+        touch_state.count = sample.count;
+        for (uint8_t i = 0; i < sample.count; i++) touch_state.points[i] = sample.points[i];
+    }
+    data->state = touch_state.count ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->point.x = touch_state.points[0].x;
+    data->point.y = touch_state.points[0].y;
+}
+
+void DisplayDriver::record_input_latency() {
+    // Appelé à la dernière zone d'une image : entrée -> image transmise au panneau
+    if (!input_pending) return;
+    input_pending = false;
+    uint32_t latency = (uint32_t)esp_timer_get_time() - pending_input_us;
+    if (latency > TOUCH_LATENCY_MAX_US) return;
+    latency_count.fetch_add(1, std::memory_order_relaxed);
+    latency_sum_us.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > latency_max_us.load(std::memory_order_relaxed)) {
+        latency_max_us.store(latency, std::memory_order_relaxed);
     }
-    data->state = LV_INDEV_STATE_RELEASED;
+}
+
+void DisplayDriver::set_gesture_callback(GestureCallback callback, void* context) {
+    gesture_ctx = context;
+    gesture_cb = callback;
+}
+
+DisplayDriver::TouchStats DisplayDriver::take_touch_stats() {
+    TouchStats stats;
+    stats.irqs = touch_irqs.exchange(0, std::memory_order_relaxed);
+    stats.reads = touch_reads.exchange(0, std::memory_order_relaxed);
+    stats.errors = touch_errors.exchange(0, std::memory_order_relaxed);
+    stats.gestures = touch_gestures.exchange(0, std::memory_order_relaxed);
+    stats.latency_count = latency_count.exchange(0, std::memory_order_relaxed);
+    stats.latency_sum_us = latency_sum_us.exchange(0, std::memory_order_relaxed);
+    stats.latency_max_us = latency_max_us.exchange(0, std::memory_order_relaxed);
+    return stats;
 }
 
 void DisplayDriver::set_brightness(uint8_t brightness) {
-    exio_set_level(LCD_BL_EXIO, brightness ? 1 : 0);
+    // Appelé depuis la tâche UI : déposé dans la file du bus, sans attente
+    if (!exio_set_level_async(LCD_BL_EXIO, brightness ? 1 : 0)) {
+        ESP_LOGW(TAG, "File I2C pleine, rétroéclairage non modifié");
+        return;
+    }
     ESP_LOGI(TAG, "Rétroéclairage %s", brightness ? "activé" : "désactivé");
 }
 
-void DisplayDriver::update() {
+uint32_t DisplayDriver::update() {
     // Mise à jour LVGL (à appeler dans la boucle principale)
-    lv_timer_handler();
+    return lv_timer_handler();
+}
+
+void DisplayDriver::set_input_task(TaskHandle_t task) {
+    input_task = task;
+    // Plus de minuterie de lecture à 33 ms : la tâche réveillée appelle read_input()
+    if (touch_indev) lv_indev_set_mode(touch_indev, task ? LV_INDEV_MODE_EVENT : LV_INDEV_MODE_TIMER);
+}
+
+void DisplayDriver::read_input() {
+    if (touch_indev) lv_indev_read(touch_indev);
+}
+
+void DisplayDriver::discard_touch_until_release() {
+    swallow_touch = true;
+}
+
+DisplayDriver::RenderStats DisplayDriver::take_render_stats() {
+    RenderStats stats;
+    stats.flushes = flush_count.exchange(0, std::memory_order_relaxed);
+    stats.bytes = flush_bytes.exchange(0, std::memory_order_relaxed);
+    stats.swaps = swap_count.exchange(0, std::memory_order_relaxed);
+    stats.frames = frame_count.exchange(0, std::memory_order_relaxed);
+    stats.copy_us = copy_us.exchange(0, std::memory_order_relaxed);
+    stats.wait_us = wait_us.exchange(0, std::memory_order_relaxed);
+    stats.vsync_timeouts = vsync_timeouts.exchange(0, std::memory_order_relaxed);
+    stats.planned_frames = planned_frames.exchange(0, std::memory_order_relaxed);
+    stats.areas_in = planned_areas_in.exchange(0, std::memory_order_relaxed);
+    stats.areas_out = planned_areas_out.exchange(0, std::memory_order_relaxed);
+    stats.requested_px = requested_px.exchange(0, std::memory_order_relaxed);
+    stats.planned_px = planned_px.exchange(0, std::memory_order_relaxed);
+    stats.refreshes = render_count.exchange(0, std::memory_order_relaxed);
+    stats.invalidated = invalidated_areas.exchange(0, std::memory_order_relaxed);
+    stats.render_us = render_us.exchange(0, std::memory_order_relaxed);
+    return stats;
 }
 
 void DisplayDriver::enable_screen() {
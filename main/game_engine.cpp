@@ -3,13 +3,25 @@
 #include "esp_random.h"
 #include "esp_timer.h"
 #include "include/species_database.h"
+#include "feeding_system.h"
+#include "habitat_system.h"
+#include "health_system.h"
+#include "reproduction_system.h"
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 
 static const char *TAG = "GameEngine";
 
-GameEngine::GameEngine() : selected_reptile_index(0) {
+// Poids des changements pour la politique d'autosauvegarde
+static constexpr uint32_t WEIGHT_MINOR = 1;  // Réglage, manipulation
+static constexpr uint32_t WEIGHT_CARE = 4;   // Repas, soin, événement aléatoire
+static constexpr uint32_t WEIGHT_STAGE = 8;  // Changement de stade de vie
+
+GameEngine::GameEngine()
+    : selected_reptile_index(0), mapped_records(nullptr), mapped_stride(0),
+      mapped_count(0), mapped_tick_ms(0), mapped_ticked(false),
+      change_weight(0), pending_events(0) {
   current_timestamp = esp_timer_get_time() / 1000; // Convertir en millisecondes
   ESP_LOGI(TAG, "Moteur de jeu initialisé");
 }
@@ -17,7 +29,9 @@ GameEngine::GameEngine() : selected_reptile_index(0) {
 GameEngine::~GameEngine() { save_game_state(); }
 
 bool GameEngine::add_reptile(ReptileSpecies species, const char *name) {
-  if (reptiles.size() >= 10) { // Limite de 10 reptiles
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  materialize();
+  if (reptiles.size() >= MAX_REPTILES) {
     ESP_LOGW(TAG, "Limite de reptiles atteinte");
     return false;
   }
@@ -70,6 +84,7 @@ bool GameEngine::add_reptile(ReptileSpecies species, const char *name) {
   new_reptile.experience_points = 0;
 
   reptiles.push_back(new_reptile);
+  mark_event(SAVE_EVENT_PURCHASE);
   const char *sci = data.scientific_name ? data.scientific_name : "Inconnu";
   ESP_LOGI(TAG, "Nouveau reptile ajouté: %s (%s)",
            name ? name : "Sans nom", sci);
@@ -178,7 +193,8 @@ void GameEngine::update_growth(Reptile &reptile) {
   }
 }
 
-bool GameEngine::feed_reptile(uint8_t index, FoodType food) {
+bool GameEngine::feed_reptile(uint16_t index, FoodType food) {
+  materialize();
   if (index >= reptiles.size())
     return false;
 
@@ -194,6 +210,7 @@ bool GameEngine::feed_reptile(uint8_t index, FoodType food) {
     }
   }
 
+  feeding_record_meal(current_timestamp, food_appropriate);
   if (food_appropriate) {
     reptile.health.hunger_level = std::max(0, reptile.health.hunger_level - 30);
     reptile.health.last_feeding = current_timestamp;
@@ -201,6 +218,7 @@ bool GameEngine::feed_reptile(uint8_t index, FoodType food) {
     // Bonus santé pour alimentation appropriée
     reptile.health.overall_health =
         std::min(100, reptile.health.overall_health + 5);
+    mark_changed(WEIGHT_CARE);
     ESP_LOGI(TAG, "%s nourri avec succès", reptile.name);
     return true;
   } else {
@@ -209,25 +227,32 @@ bool GameEngine::feed_reptile(uint8_t index, FoodType food) {
   }
 }
 
-bool GameEngine::adjust_temperature(uint8_t index, float new_temp) {
+bool GameEngine::adjust_temperature(uint16_t index, float new_temp) {
+  materialize();
   if (index >= reptiles.size())
     return false;
 
   reptiles[index].habitat.temperature_day = new_temp;
+  mark_changed(WEIGHT_MINOR);
+  habitat_record_adjustment();
   ESP_LOGI(TAG, "Température ajustée pour %s", reptiles[index].name);
   return true;
 }
 
-bool GameEngine::adjust_humidity(uint8_t index, float new_humidity) {
+bool GameEngine::adjust_humidity(uint16_t index, float new_humidity) {
+  materialize();
   if (index >= reptiles.size())
     return false;
 
   reptiles[index].habitat.humidity = new_humidity;
+  mark_changed(WEIGHT_MINOR);
+  habitat_record_adjustment();
   ESP_LOGI(TAG, "Humidité ajustée pour %s", reptiles[index].name);
   return true;
 }
 
-bool GameEngine::toggle_lighting(uint8_t index) {
+bool GameEngine::toggle_lighting(uint16_t index) {
+  materialize();
   if (index >= reptiles.size())
     return false;
 
@@ -236,27 +261,34 @@ bool GameEngine::toggle_lighting(uint8_t index) {
       reptile.habitat.photoperiod
           ? 0
           : get_species_data(reptile.species).environment.photoperiod_summer;
+  mark_changed(WEIGHT_MINOR);
+  habitat_record_adjustment();
   ESP_LOGI(TAG, "Éclairage %s pour %s",
            reptile.habitat.photoperiod ? "activé" : "désactivé", reptile.name);
   return true;
 }
 
-bool GameEngine::clean_terrarium(uint8_t index) {
+bool GameEngine::clean_terrarium(uint16_t index) {
+  materialize();
   if (index >= reptiles.size())
     return false;
 
   Reptile &reptile = reptiles[index];
   reptile.health.stress_level =
       std::max<int>(0, static_cast<int>(reptile.health.stress_level) - 10);
+  mark_changed(WEIGHT_MINOR);
+  habitat_record_cleaning(current_timestamp);
   ESP_LOGI(TAG, "Terrarium nettoyé pour %s", reptile.name);
   return true;
 }
 
-bool GameEngine::diagnose_health_issue(uint8_t index) {
-  if (index >= reptiles.size())
+bool GameEngine::diagnose_health_issue(uint16_t index) {
+  const Reptile *found = peek_reptile(index);
+  if (!found)
     return false;
 
-  Reptile &reptile = reptiles[index];
+  const Reptile &reptile = *found;
+  health_record_diagnosis();
 
   if (reptile.health.hunger_level > 80) {
     ESP_LOGW(TAG, "%s présente un niveau de faim élevé", reptile.name);
@@ -278,22 +310,69 @@ bool GameEngine::diagnose_health_issue(uint8_t index) {
   return true;
 }
 
-void GameEngine::update(uint32_t delta_time_ms) {
-  current_timestamp += delta_time_ms;
+void GameEngine::simulate_tick(Reptile &reptile) {
+  uint32_t time_diff = current_timestamp - reptile.last_update;
+  LifeStage previous_stage = reptile.life_stage;
+  bool was_alive = reptile.health.overall_health > 0;
 
-  for (auto &reptile : reptiles) {
-    uint32_t time_diff = current_timestamp - reptile.last_update;
+  // Mise à jour de l'âge
+  reptile.age_days =
+      (current_timestamp - reptile.birth_timestamp) / (24 * 60 * 60 * 1000);
 
-    // Mise à jour de l'âge
-    reptile.age_days =
-        (current_timestamp - reptile.birth_timestamp) / (24 * 60 * 60 * 1000);
+  // Mises à jour physiologiques
+  update_physiology(reptile, time_diff);
+  update_behavior(reptile);
+  update_growth(reptile);
 
-    // Mises à jour physiologiques
-    update_physiology(reptile, time_diff);
-    update_behavior(reptile);
-    update_growth(reptile);
+  if (reptile.life_stage != previous_stage) {
+    mark_changed(WEIGHT_STAGE);
+  }
+  if (was_alive && reptile.health.overall_health == 0) {
+    mark_event(SAVE_EVENT_DEATH);
+    ESP_LOGW(TAG, "%s n'a pas survécu", reptile.name);
+  }
+
+  reptile.last_update = current_timestamp;
+}
+
+// Même état, horodatage du tick mis à part
+static bool same_state(const Reptile &next, const Reptile &stored) {
+  Reptile candidate;
+  memcpy(&candidate, &next, sizeof(Reptile));
+  candidate.last_update = stored.last_update;
+  return memcmp(&candidate, &stored, sizeof(Reptile)) == 0;
+}
 
-    reptile.last_update = current_timestamp;
+void GameEngine::update(uint32_t delta_time_ms) {
+  current_timestamp += delta_time_ms;
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+
+  // Simulation sur des copies lues par peek_reptile : la projection n'est
+  // copiée en RAM que si un enregistrement change réellement (stade, mue,
+  // stress qui n'a pas atteint sa borne...). En régime établi, seul
+  // l'horodatage avance, suivi à part dans mapped_tick_ms.
+  size_t count = get_reptile_count();
+  tick_scratch.resize(count);
+  bool changed = !mapped_records;
+  for (size_t i = 0; i < count; i++) {
+    const Reptile *stored = peek_reptile(i);
+    Reptile &reptile = tick_scratch[i];
+    memcpy(&reptile, stored, sizeof(Reptile));
+    if (mapped_records && mapped_ticked) {
+      reptile.last_update = mapped_tick_ms;
+    }
+    simulate_tick(reptile);
+    if (!changed && !same_state(reptile, *stored)) {
+      changed = true;
+    }
+  }
+
+  if (changed) {
+    materialize();
+    reptiles.swap(tick_scratch);
+  } else {
+    mapped_tick_ms = current_timestamp;
+    mapped_ticked = true;
   }
 
   // Événements aléatoires occasionnels
@@ -303,6 +382,8 @@ void GameEngine::update(uint32_t delta_time_ms) {
 }
 
 void GameEngine::trigger_random_events() {
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  materialize();
   if (reptiles.empty())
     return;
 
@@ -310,6 +391,7 @@ void GameEngine::trigger_random_events() {
   Reptile &reptile = reptiles[random_reptile];
 
   uint32_t event_type = esp_random() % 100;
+  mark_changed(WEIGHT_CARE);
 
   if (event_type < 10) { // 10% - Stress environnemental
     reptile.health.stress_level =
@@ -325,43 +407,113 @@ void GameEngine::trigger_random_events() {
   }
 }
 
-size_t GameEngine::get_reptile_count() const { return reptiles.size(); }
+size_t GameEngine::get_reptile_count() const {
+  return mapped_records ? mapped_count : reptiles.size();
+}
 
-const std::vector<Reptile>& GameEngine::get_reptiles() const { return reptiles; }
+const std::vector<Reptile>& GameEngine::get_reptiles() {
+  materialize();
+  return reptiles;
+}
 
 void GameEngine::set_reptiles(const std::vector<Reptile>& new_reptiles) {
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  mapped_records = nullptr;
+  mapped_count = 0;
+  mapped_ticked = false;
   reptiles = new_reptiles;
 }
 
-Reptile *GameEngine::get_reptile(uint8_t index) {
+void GameEngine::attach_mapped_reptiles(const uint8_t *records, size_t stride,
+                                        size_t count) {
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  reptiles.clear();
+  mapped_records = count ? records : nullptr;
+  mapped_stride = stride;
+  mapped_count = count;
+  mapped_ticked = false;
+  if (selected_reptile_index >= count) {
+    selected_reptile_index = 0;
+  }
+  ESP_LOGI(TAG, "%zu reptiles projetés depuis la sauvegarde", count);
+}
+
+bool GameEngine::has_mapped_reptiles() const { return mapped_records != nullptr; }
+
+void GameEngine::clear_changes() {
+  change_weight = 0;
+  pending_events = 0;
+}
+
+void GameEngine::materialize() {
+  if (!mapped_records)
+    return;
+
+  // Copie unique des enregistrements projetés avant toute modification,
+  // publiée sous le verrou : l'appelant ne libère la projection qu'ensuite
+  std::vector<Reptile> owned(mapped_count);
+  for (size_t i = 0; i < mapped_count; i++) {
+    memcpy(&owned[i], mapped_records + i * mapped_stride, sizeof(Reptile));
+    if (mapped_ticked) {
+      owned[i].last_update = mapped_tick_ms;
+    }
+  }
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  reptiles.swap(owned);
+  mapped_records = nullptr;
+  mapped_count = 0;
+  mapped_ticked = false;
+}
+
+const Reptile *GameEngine::peek_reptile(uint16_t index) const {
+  if (mapped_records) {
+    if (index >= mapped_count)
+      return nullptr;
+    return reinterpret_cast<const Reptile *>(mapped_records +
+                                             index * mapped_stride);
+  }
+  if (index >= reptiles.size())
+    return nullptr;
+  return &reptiles[index];
+}
+
+Reptile *GameEngine::get_reptile(uint16_t index) {
+  // Accès modifiable : copie en RAM, mais aucun changement présumé ; les
+  // mutateurs du moteur signalent eux-mêmes leurs modifications. Lecture
+  // seule : peek_reptile()
+  materialize();
   if (index >= reptiles.size())
     return nullptr;
   return &reptiles[index];
 }
 
-void GameEngine::select_reptile(uint8_t index) {
-  if (index < reptiles.size()) {
+void GameEngine::select_reptile(uint16_t index) {
+  if (index < get_reptile_count()) {
     selected_reptile_index = index;
   }
 }
 
-uint8_t GameEngine::get_selected_reptile() const {
+uint16_t GameEngine::get_selected_reptile() const {
   return selected_reptile_index;
 }
 
-bool GameEngine::remove_reptile(uint8_t index) {
+bool GameEngine::remove_reptile(uint16_t index) {
+  std::lock_guard<std::recursive_mutex> lock(storage_lock);
+  materialize();
   if (index >= reptiles.size()) {
     return false;
   }
 
   reptiles.erase(reptiles.begin() + index);
+  mark_event(SAVE_EVENT_DEATH);
   if (selected_reptile_index >= reptiles.size()) {
     selected_reptile_index = reptiles.empty() ? 0 : reptiles.size() - 1;
   }
   return true;
 }
 
-bool GameEngine::handle_reptile(uint8_t index) {
+bool GameEngine::handle_reptile(uint16_t index) {
+  materialize();
   if (index >= reptiles.size()) {
     return false;
   }
@@ -371,23 +523,32 @@ bool GameEngine::handle_reptile(uint8_t index) {
     reptile.health.stress_level -= 1;
   }
   reptile.experience_points += 1;
+  mark_changed(WEIGHT_MINOR);
   return true;
 }
 
-bool GameEngine::can_breed(uint8_t female_index, uint8_t male_index) {
-  if (female_index >= reptiles.size() || male_index >= reptiles.size()) {
+bool GameEngine::can_breed(uint16_t female_index, uint16_t male_index) {
+  if (female_index >= get_reptile_count() ||
+      male_index >= get_reptile_count()) {
     return false;
   }
   return false; // Système de reproduction non implémenté
 }
 
-bool GameEngine::initiate_breeding(uint8_t female_index, uint8_t male_index) {
-  (void)female_index;
-  (void)male_index;
-  return false; // Fonctionnalité non disponible
+bool GameEngine::initiate_breeding(uint16_t female_index, uint16_t male_index) {
+  bool success = can_breed(female_index, male_index);
+  if (female_index < get_reptile_count() && male_index < get_reptile_count()) {
+    reproduction_record_attempt(current_timestamp, success);
+  }
+  if (!success) {
+    return false; // Fonctionnalité non disponible
+  }
+  mark_event(SAVE_EVENT_BREEDING);
+  return true;
 }
 
-bool GameEngine::treat_health_issue(uint8_t index, const char *treatment) {
+bool GameEngine::treat_health_issue(uint16_t index, const char *treatment) {
+  materialize();
   if (index >= reptiles.size() || treatment == nullptr) {
     return false;
   }
@@ -396,13 +557,15 @@ bool GameEngine::treat_health_issue(uint8_t index, const char *treatment) {
   reptile.health.overall_health =
       std::min<uint8_t>(100, reptile.health.overall_health + 5);
   reptile.experience_points += 2;
+  mark_changed(WEIGHT_CARE);
+  health_record_treatment(current_timestamp);
   return true;
 }
 
 uint32_t GameEngine::get_total_experience() const {
   uint32_t total = 0;
-  for (const auto &r : reptiles) {
-    total += r.experience_points;
+  for (size_t i = 0; i < get_reptile_count(); i++) {
+    total += peek_reptile(i)->experience_points;
   }
   return total;
 }
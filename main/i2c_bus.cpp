@@ -0,0 +1,176 @@
+#include "include/i2c_bus.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <cstring>
+
+static const char* TAG = "I2cBus";
+
+bool I2cBus::begin(i2c_port_num_t port, gpio_num_t sda, gpio_num_t scl, uint32_t xfer_timeout_ms) {
+    i2c_master_bus_config_t bus_conf = {};
+    bus_conf.i2c_port = port;
+    bus_conf.sda_io_num = sda;
+    bus_conf.scl_io_num = scl;
+    bus_conf.clk_source = I2C_CLK_SRC_DEFAULT;
+    bus_conf.glitch_ignore_cnt = 7;
+    bus_conf.flags.enable_internal_pullup = true;
+    esp_err_t err = i2c_new_master_bus(&bus_conf, &bus);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Bus I2C %d indisponible: %s", (int)port, esp_err_to_name(err));
+        return false;
+    }
+    timeout_ms = xfer_timeout_ms;
+
+    // Au-dessus de la lecture tactile (4) qui attend ses transactions
+    if (xTaskCreatePinnedToCore(bus_task, "I2cBus", 3072, this, 5, &task_handle, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Tâche du bus impossible");
+        return false;
+    }
+    return true;
+}
+
+uint8_t I2cBus::add_device(uint16_t address, uint32_t scl_hz, const char* name) {
+    if (!bus || device_count >= I2C_MAX_DEVICES) return I2C_NO_DEVICE;
+
+    i2c_device_config_t dev_conf = {};
+    dev_conf.dev_addr_length = I2C_ADDR_BIT_LEN_7;
+    dev_conf.device_address = address;
+    dev_conf.scl_speed_hz = scl_hz;
+    esp_err_t err = i2c_master_bus_add_device(bus, &dev_conf, &devices[device_count]);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Ajout de %s (0x%02X) impossible: %s", name, address, esp_err_to_name(err));
+        return I2C_NO_DEVICE;
+    }
+    names[device_count] = name;
+    return device_count++;
+}
+
+bool I2cBus::submit(const I2cRequest& request) {
+    if (!task_handle || request.device >= device_count || request.tx_len > I2C_TX_MAX) return false;
+
+    I2cRequest queued = request;
+    queued.submit_us = (uint32_t)esp_timer_get_time();
+    portENTER_CRITICAL(&lock);
+    I2cScheduler::PushResult result = scheduler.push(queued);
+    if (result == I2cScheduler::PushResult::FULL) rejected++;
+    portEXIT_CRITICAL(&lock);
+
+    if (result == I2cScheduler::PushResult::FULL) return false;
+    xTaskNotifyGive(task_handle);
+    return true;
+}
+
+bool I2cBus::write_async(uint8_t device, const uint8_t* data, uint8_t len, I2cPriority priority) {
+    if (len == 0 || len > I2C_TX_MAX) return false;
+    I2cRequest request = {};
+    request.device = device;
+    request.priority = priority;
+    request.tx_len = len;
+    memcpy(request.tx, data, len);
+    return submit(request);
+}
+
+namespace {
+struct SyncWait {
+    SemaphoreHandle_t done;
+    I2cStatus status;
+};
+
+void on_sync_done(void* context, I2cStatus status) {
+    SyncWait* wait = static_cast<SyncWait*>(context);
+    wait->status = status;
+    xSemaphoreGive(wait->done);
+}
+}
+
+I2cStatus I2cBus::transfer(uint8_t device, const uint8_t* tx, uint8_t tx_len, uint8_t* rx, uint16_t rx_len,
+                           I2cPriority priority) {
+    if (tx_len > I2C_TX_MAX) return I2cStatus::REJECTED;
+
+    // Sémaphore sur la pile : la tâche du bus termine toujours la transaction
+    // (plafond timeout_ms), l'attente sans limite est donc bornée
+    StaticSemaphore_t sem_storage;
+    SyncWait wait = {xSemaphoreCreateBinaryStatic(&sem_storage), I2cStatus::REJECTED};
+
+    I2cRequest request = {};
+    request.device = device;
+    request.priority = priority;
+    request.tx_len = tx_len;
+    if (tx_len) memcpy(request.tx, tx, tx_len);
+    request.rx = rx;
+    request.rx_len = rx_len;
+    request.done = on_sync_done;
+    request.context = &wait;
+    if (submit(request)) {
+        xSemaphoreTake(wait.done, portMAX_DELAY);
+    }
+    vSemaphoreDelete(wait.done);
+    return wait.status;
+}
+
+I2cStatus I2cBus::execute(const I2cRequest& request) {
+    i2c_master_dev_handle_t dev = devices[request.device];
+    esp_err_t err = request.rx_len
+        ? i2c_master_transmit_receive(dev, request.tx, request.tx_len, request.rx, request.rx_len, timeout_ms)
+        : i2c_master_transmit(dev, request.tx, request.tx_len, timeout_ms);
+    if (err == ESP_OK) return I2cStatus::OK;
+    if (err == ESP_ERR_TIMEOUT) {
+        // Bus bloqué (esclave qui retient SDA) : on tente de le libérer
+        i2c_master_bus_reset(bus);
+        return I2cStatus::TIMEOUT;
+    }
+    return I2cStatus::ERROR;
+}
+
+void I2cBus::bus_task(void* arg) {
+    I2cBus* self = static_cast<I2cBus*>(arg);
+    uint8_t last_device = I2C_NO_DEVICE;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Vide la file : les soumissions arrivées entre-temps sont servies dans
+        // le même réveil, la priorité est réévaluée à chaque transaction
+        while (true) {
+            I2cRequest request;
+            portENTER_CRITICAL(&self->lock);
+            bool found = self->scheduler.pop(request, last_device);
+            portEXIT_CRITICAL(&self->lock);
+            if (!found) break;
+
+            uint32_t start_us = (uint32_t)esp_timer_get_time();
+            I2cStatus status = self->execute(request);
+            uint32_t end_us = (uint32_t)esp_timer_get_time();
+            last_device = request.device;
+
+            portENTER_CRITICAL(&self->lock);
+            self->scheduler.record(request.device, end_us - request.submit_us, end_us - start_us, status);
+            portEXIT_CRITICAL(&self->lock);
+
+            if (request.done) request.done(request.context, status);
+        }
+    }
+}
+
+I2cDeviceStats I2cBus::take_device_stats(uint8_t device) {
+    portENTER_CRITICAL(&lock);
+    I2cDeviceStats stats = scheduler.take_stats(device);
+    portEXIT_CRITICAL(&lock);
+    return stats;
+}
+
+void I2cBus::log_report() {
+    for (uint8_t i = 0; i < device_count; i++) {
+        I2cDeviceStats stats = take_device_stats(i);
+        ESP_LOGI(TAG, "I2C %s: %u transactions, %u fusionnées, %u erreurs, %u timeouts, latence %u us (max %u us, bus %u us)",
+                 names[i], (unsigned)stats.transactions, (unsigned)stats.merged, (unsigned)stats.errors,
+                 (unsigned)stats.timeouts,
+                 (unsigned)(stats.transactions ? stats.latency_sum_us / stats.transactions : 0),
+                 (unsigned)stats.latency_max_us,
+                 (unsigned)(stats.transactions ? stats.bus_us / stats.transactions : 0));
+    }
+    portENTER_CRITICAL(&lock);
+    uint32_t dropped = rejected;
+    rejected = 0;
+    portEXIT_CRITICAL(&lock);
+    if (dropped) ESP_LOGW(TAG, "File I2C pleine: %u transactions rejetées", (unsigned)dropped);
+}
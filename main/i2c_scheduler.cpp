@@ -0,0 +1,79 @@
+#include "include/i2c_scheduler.h"
+#include <cstring>
+
+I2cScheduler::PushResult I2cScheduler::push(const I2cRequest& request) {
+    if (is_plain_write(request)) {
+        for (uint8_t i = 0; i < I2C_QUEUE_LENGTH; i++) {
+            Slot& slot = slots[i];
+            if (!slot.used || !is_plain_write(slot.request)) continue;
+            if (slot.request.device != request.device || slot.request.tx_len != request.tx_len ||
+                slot.request.tx[0] != request.tx[0]) continue;
+            // Même registre : la nouvelle valeur remplace l'ancienne, la latence
+            // reste comptée depuis la première soumission
+            memcpy(slot.request.tx, request.tx, request.tx_len);
+            if (request.priority < slot.request.priority) slot.request.priority = request.priority;
+            if (request.device < I2C_MAX_DEVICES) stats[request.device].merged++;
+            return PushResult::MERGED;
+        }
+    }
+
+    for (uint8_t i = 0; i < I2C_QUEUE_LENGTH; i++) {
+        Slot& slot = slots[i];
+        if (slot.used) continue;
+        slot.used = true;
+        slot.sequence = next_sequence++;
+        slot.request = request;
+        pending++;
+        return PushResult::QUEUED;
+    }
+    return PushResult::FULL;
+}
+
+bool I2cScheduler::pop(I2cRequest& request, uint8_t last_device) {
+    int best = -1;
+    for (uint8_t i = 0; i < I2C_QUEUE_LENGTH; i++) {
+        const Slot& slot = slots[i];
+        if (!slot.used) continue;
+        if (best < 0) {
+            best = i;
+            continue;
+        }
+        const Slot& current = slots[best];
+        if (slot.request.priority != current.request.priority) {
+            if (slot.request.priority < current.request.priority) best = i;
+            continue;
+        }
+        bool slot_batch = slot.request.device == last_device && is_plain_write(slot.request);
+        bool current_batch = current.request.device == last_device && is_plain_write(current.request);
+        if (slot_batch != current_batch) {
+            if (slot_batch) best = i;
+            continue;
+        }
+        // Numéros de séquence croissants : la différence signée survit au débordement
+        if ((int32_t)(slot.sequence - current.sequence) < 0) best = i;
+    }
+    if (best < 0) return false;
+
+    request = slots[best].request;
+    slots[best].used = false;
+    pending--;
+    return true;
+}
+
+void I2cScheduler::record(uint8_t device, uint32_t latency_us, uint32_t bus_us, I2cStatus status) {
+    if (device >= I2C_MAX_DEVICES) return;
+    I2cDeviceStats& s = stats[device];
+    s.transactions++;
+    if (status == I2cStatus::TIMEOUT) s.timeouts++;
+    else if (status != I2cStatus::OK) s.errors++;
+    s.latency_sum_us += latency_us;
+    if (latency_us > s.latency_max_us) s.latency_max_us = latency_us;
+    s.bus_us += bus_us;
+}
+
+I2cDeviceStats I2cScheduler::take_stats(uint8_t device) {
+    if (device >= I2C_MAX_DEVICES) return {};
+    I2cDeviceStats result = stats[device];
+    stats[device] = {};
+    return result;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Politique de sauvegarde automatique : arbitre entre l'importance des
+// changements en attente et un budget quotidien d'écriture flash.
+//
+// Le budget est un seau à jetons exprimé en octets effacés : il se
+// remplit au rythme qui permet d'atteindre `target_lifetime_days` avec
+// `erase_cycles` cycles par secteur sur la zone d'usure (slots A/B).
+// Les événements importants (achat, mort, reproduction) passent outre.
+class AutosavePolicy {
+public:
+    struct Config {
+        uint32_t min_interval_ms = 10000;        // Écart minimal hors événement
+        uint32_t max_interval_ms = 600000;       // Dérive de simulation sauvée au plus tard
+        uint32_t dirty_threshold = 8;            // Poids de changements déclenchant une sauvegarde
+        uint32_t erase_cycles = 100000;          // Endurance NOR annoncée par secteur
+        uint32_t target_lifetime_days = 3650;    // Durée de vie visée
+        size_t wear_area_bytes = 2 * 64 * 1024;  // Zone alternée (slots A/B)
+        uint32_t burst_ms = 3600000;             // Capacité du seau (durée de budget)
+    };
+
+    enum Decision : uint8_t {
+        SKIP_CLEAN = 0,     // Rien à sauvegarder
+        SKIP_INTERVAL,      // Changements mineurs, trop tôt
+        DEFER_BUDGET,       // Budget flash épuisé
+        SAVE_DIRTY,         // Seuil de changements atteint
+        SAVE_EVENT,         // Événement important (forcé)
+        SAVE_MAX_INTERVAL   // Dérive accumulée trop ancienne
+    };
+
+    static bool should_save(Decision decision) { return decision >= SAVE_DIRTY; }
+    static const char* decision_name(Decision decision);
+
+private:
+    Config config;
+    int64_t budget_tokens = 0;       // Octets effaçables immédiatement
+    uint32_t last_refill_ms = 0;
+    uint32_t last_save_ms = 0;
+    uint32_t session_start_ms = 0;
+    bool started = false;
+
+    uint64_t lifetime_erased = 0;    // Cumul persistant (NVS)
+    uint64_t session_erased = 0;
+
+    void refill(uint32_t now_ms);
+    int64_t bucket_capacity() const;
+
+public:
+    void configure(const Config& cfg);
+    const Config& get_config() const { return config; }
+
+    // `change_weight` : poids cumulé depuis la dernière sauvegarde,
+    // `events` : masque d'événements importants en attente
+    Decision evaluate(uint32_t now_ms, uint32_t change_weight, uint32_t events);
+
+    // Octets effacés par une sauvegarde effective (toutes origines)
+    void record_write(uint32_t now_ms, size_t erased_bytes);
+    // Effacement hors sauvegarde primaire (slot d'urgence) : imputé au budget
+    // et à l'usure sans repousser l'échéance d'autosauvegarde
+    void record_erase(uint32_t now_ms, size_t erased_bytes);
+
+    void set_lifetime_erased(uint64_t bytes) { lifetime_erased = bytes; }
+    uint64_t get_lifetime_erased() const { return lifetime_erased; }
+
+    uint64_t daily_budget_bytes() const;
+    uint64_t session_daily_rate(uint32_t now_ms) const;
+    uint32_t projected_lifetime_days(uint32_t now_ms) const;
+    // Cycles d'effacement moyens consommés par secteur, en millièmes
+    uint32_t wear_millicycles() const;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Rendu logiciel de la décoration statique d'une carte (ombre portée et coins
+// arrondis) en RGB565, composée d'avance sur la couleur du fond parent.
+// Seul l'anneau extérieur est rendu, en quatre bandes : l'intérieur reste un
+// simple remplissage LVGL, sans ombre à recalculer à chaque invalidation.
+struct CardLayerKey {
+    uint16_t width;
+    uint16_t height;
+    uint8_t radius;
+    uint8_t shadow_width;       // Largeur de flou LVGL (style shadow_width)
+    uint8_t shadow_opa;
+    uint32_t bg_rgb;            // 0xRRGGBB
+    uint32_t shadow_rgb;
+    uint32_t backdrop_rgb;      // Fond du parent sous l'ombre
+
+    bool operator==(const CardLayerKey& other) const {
+        return width == other.width && height == other.height && radius == other.radius &&
+               shadow_width == other.shadow_width && shadow_opa == other.shadow_opa &&
+               bg_rgb == other.bg_rgb && shadow_rgb == other.shadow_rgb &&
+               backdrop_rgb == other.backdrop_rgb;
+    }
+};
+
+enum CardStrip : uint8_t {
+    CARD_STRIP_TOP = 0,         // Ombre haute + coins supérieurs
+    CARD_STRIP_BOTTOM,
+    CARD_STRIP_LEFT,            // Ombre latérale entre les coins
+    CARD_STRIP_RIGHT,
+    CARD_STRIP_COUNT
+};
+
+struct CardStripRect {
+    int16_t x;                  // Relatif au coin supérieur gauche de la carte
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+// Débord de l'ombre hors de la carte (comme l'ext_draw_size LVGL)
+uint16_t card_layer_extent(const CardLayerKey& key);
+CardStripRect card_layer_strip(const CardLayerKey& key, CardStrip strip);
+size_t card_layer_bytes(const CardLayerKey& key);
+
+// Pixel RGB565 aux coordonnées (x, y) relatives à la carte
+uint16_t card_layer_pixel(const CardLayerKey& key, int x, int y);
+// Remplit `out` (largeur de bande x hauteur, pas = largeur)
+void card_layer_render(const CardLayerKey& key, CardStrip strip, uint16_t* out);
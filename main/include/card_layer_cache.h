@@ -0,0 +1,74 @@
+#pragma once
+
+#include "lvgl.h"
+#include "card_layer.h"
+
+// Cache des couches statiques des cartes : l'ombre de `style_card` est rendue
+// une fois en bandes RGB565 (PSRAM) affichées comme images enfants flottantes
+// de la carte ; la carte garde son remplissage mais perd son ombre calculée.
+// Les couches sont partagées entre cartes identiques et refaites quand la
+// taille ou le style de la carte change.
+class CardLayerCache {
+public:
+    static constexpr uint8_t MAX_LAYERS = 12;
+    static constexpr uint8_t MAX_CARDS = 24;
+
+    struct Style {
+        uint32_t bg_rgb;
+        uint8_t radius;
+        uint8_t shadow_width;
+        uint8_t shadow_opa;
+        uint32_t shadow_rgb;
+    };
+
+    struct Stats {
+        uint32_t renders;           // Couches rendues
+        uint32_t hits;              // Couche existante réutilisée
+        uint32_t last_render_us;
+        uint32_t resident_bytes;
+    };
+
+private:
+    struct Layer {
+        CardLayerKey key;
+        uint16_t* pixels[CARD_STRIP_COUNT];
+        lv_image_dsc_t images[CARD_STRIP_COUNT];
+        uint8_t users;
+    };
+
+    struct Card {
+        lv_obj_t* obj;
+        lv_obj_t* strips[CARD_STRIP_COUNT];
+        int8_t layer;
+        bool flat;                  // flat_style appliqué
+    };
+
+    Layer layers[MAX_LAYERS] = {};
+    Card cards[MAX_CARDS] = {};
+    Style style = {};
+    lv_style_t flat_style;          // Ombre désactivée sur les cartes servies
+    bool enabled = true;
+    Stats stats = {};
+
+    Card* find_card(lv_obj_t* obj);
+    int8_t acquire_layer(const CardLayerKey& key);
+    void release_layer(int8_t index);
+    void set_flat(Card& card, bool flat);
+    void refresh(Card& card);
+    void detach(Card& card);
+
+    static void on_card_event(lv_event_t* e);
+
+public:
+    CardLayerCache();
+
+    // Paramètres de la décoration, identiques à ceux de style_card
+    void set_style(const Style& card_style);
+    // Prend en charge une carte, une fois stylée (style_card) et dimensionnée
+    bool attach(lv_obj_t* card);
+
+    // Désactivation : retour à l'ombre LVGL, pour mesurer l'écart de rendu
+    void set_enabled(bool enable);
+    bool is_enabled() const { return enabled; }
+    const Stats& get_stats() const { return stats; }
+};
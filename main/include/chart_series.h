@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Extrêmes d'un groupe d'échantillons consécutifs
+struct ChartBucket {
+    int16_t min;
+    int16_t max;
+};
+
+// Historique multi-résolution pour lv_chart : pyramide de paliers min/max,
+// chaque palier regroupant TIER_FACTOR cases du palier inférieur. Un ajout
+// coûte O(1) amorti ; un niveau de zoom correspond à un palier, une colonne
+// de pixels à une case : l'affichage ne re-décime jamais l'historique brut.
+// Min/max conserve les pics (fièvre, coup de froid) qu'une moyenne lisserait.
+// Aucune dépendance LVGL (voir VitalsChart).
+class ChartSeries {
+public:
+    static constexpr uint8_t TIER_COUNT = 5;
+    static constexpr uint8_t TIER_FACTOR = 4;
+
+private:
+    ChartBucket* rings[TIER_COUNT] = {};
+    uint32_t completed[TIER_COUNT] = {};    // Cases terminées depuis le début
+    ChartBucket pending[TIER_COUNT] = {};   // Case en cours de remplissage
+    uint16_t pending_count[TIER_COUNT] = {};
+    uint16_t capacity = 0;
+
+    void push(uint8_t tier, ChartBucket bucket);
+
+public:
+    ChartSeries() = default;
+    ~ChartSeries();
+    ChartSeries(const ChartSeries&) = delete;
+    ChartSeries& operator=(const ChartSeries&) = delete;
+
+    // Cases conservées par palier (au moins la largeur du graphique en pixels)
+    bool init(uint16_t buckets_per_tier);
+    void clear();
+    void append(int16_t value);
+
+    uint16_t get_capacity() const { return capacity; }
+    static uint32_t samples_per_bucket(uint8_t tier);
+    // Compteur monotone : un consommateur n'applique que les cases nouvelles
+    uint32_t completed_count(uint8_t tier) const { return tier < TIER_COUNT ? completed[tier] : 0; }
+    uint16_t stored(uint8_t tier) const;
+    // Case terminée d'indice absolu `sequence` (doit encore être conservée)
+    ChartBucket bucket(uint8_t tier, uint32_t sequence) const;
+    // Plus petit palier dont `columns` cases couvrent `span_samples`
+    static uint8_t tier_for_span(uint32_t span_samples, uint16_t columns);
+    size_t memory_bytes() const { return (size_t)capacity * TIER_COUNT * sizeof(ChartBucket); }
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-32C (Castagnoli, polynôme réfléchi 0x82F63B78).
+// Chaînable : crc32c(b, nb, crc32c(a, na)) == crc32c(a||b, na + nb).
+// Slicing-by-8 en logiciel ; instruction SSE4.2 sur hôte x86 si disponible.
+uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0);
+// Tests : impose le slicing-by-8, seul chemin sur ESP32-S3 (sans effet sur cible)
+void crc32c_force_software(bool force);
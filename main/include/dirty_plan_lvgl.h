@@ -0,0 +1,13 @@
+#pragma once
+
+#include "dirty_planner.h"
+#include "lvgl.h"
+
+// Application d'un DirtyPlanner aux zones invalidées d'un affichage LVGL, au
+// début du rafraîchissement (LV_EVENT_REFR_START). Partagé par DisplayDriver
+// et le banc de rendu hôte, pour que les deux planifient à l'identique.
+//
+// Mise en page anticipée, puis réécriture de inv_areas selon `planner`
+// (nullptr : mise en page seule). `result` reçoit toujours le nombre de zones
+// avant et après ; retourne true si le plan a été appliqué (au moins 2 zones).
+bool plan_display_areas(lv_display_t* display, const DirtyPlanner* planner, DirtyPlanner::Result& result);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Zone à rafraîchir, bornes incluses (comme lv_area_t)
+struct DirtyRect {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+};
+
+// Planification des zones invalidées avant le rendu : alignement horizontal
+// sur les lignes de cache / rafales PSRAM, fusion des zones voisines quand le
+// surcoût de pixels est inférieur au coût fixe d'un flush, et plafond de
+// fragmentation. Aucune dépendance LVGL : DisplayDriver applique le plan aux
+// zones invalidées de l'affichage.
+class DirtyPlanner {
+public:
+    struct CostModel {
+        uint32_t flush_overhead_px;     // Coût fixe d'une zone, en pixels équivalents
+        uint16_t align_px;              // Alignement des bords gauche et droit (puissance de 2)
+        uint8_t max_areas;              // Plafond de zones par image
+    };
+
+    struct Result {
+        uint16_t areas_in;
+        uint16_t areas_out;
+        uint32_t requested_px;          // Somme des zones reçues
+        uint32_t flushed_px;            // Somme des zones planifiées
+    };
+
+private:
+    CostModel model = {4096, 32, 8};
+    int32_t width = 0;
+    int32_t height = 0;
+
+public:
+    void configure(int32_t screen_width, int32_t screen_height, const CostModel& cost_model);
+    const CostModel& get_model() const { return model; }
+
+    // Réécrit `rects` sur place ; les areas_out premières zones sont conservées
+    Result plan(DirtyRect* rects, size_t count) const;
+
+    static uint32_t area(const DirtyRect& rect);
+    static DirtyRect join(const DirtyRect& a, const DirtyRect& b);
+};
@@ -3,8 +3,14 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_rgb.h"
 #include "lvgl.h"
-#include "driver/i2c.h"
+#include "dirty_planner.h"
+#include "touch_input.h"
+#include "i2c_bus.h"
 #include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include <atomic>
 
 // Configuration spécifique Waveshare ESP32-S3 7" Touch LCD
 #define LCD_WIDTH           1024
@@ -54,31 +60,137 @@
 #define TOUCH_RST_PIN       GPIO_NUM_NC  // Reset via expander
 #define TOUCH_RST_EXIO      1           // EXIO1 : reset tactile
 
+// PARTIAL : LVGL rend dans deux tampons de 60 lignes recopiés dans l'unique
+// framebuffer du panneau (copie supplémentaire, déchirure possible).
+// DIRECT : deux framebuffers panneau ; LVGL rend dans celui qui n'est pas
+// balayé et l'échange a lieu au VSYNC.
+enum class RenderMode : uint8_t {
+    PARTIAL = 0,
+    DIRECT
+};
+
+// Profils de balayage RGB. Sans tampon de rebond, le contrôleur LCD lit le
+// framebuffer en PSRAM par DMA et se dispute le bus octal avec le rendu LVGL ;
+// avec, le CPU recopie `bounce_lines` lignes à l'avance en SRAM interne, ce
+// qui autorise une horloge pixel plus haute sans sous-alimentation.
+enum class LcdProfile : uint8_t {
+    SAFE = 0,       // 12 MHz, DMA direct depuis la PSRAM (configuration d'origine)
+    BALANCED,       // 16 MHz, 10 lignes de rebond
+    FAST            // 21 MHz, 20 lignes de rebond
+};
+
+struct LcdTimingProfile {
+    const char* name;
+    uint32_t pclk_hz;
+    uint16_t bounce_lines;          // 0 = pas de tampon de rebond
+};
+
+typedef void (*GestureCallback)(void* context, const TouchGesture& gesture);
+
 class DisplayDriver {
 private:
     esp_lcd_panel_handle_t panel_handle;
+    RenderMode render_mode;
+    LcdProfile lcd_profile;
     
     // Buffers LVGL
     static lv_display_t* lvgl_display;
     static lv_color_t* buf1;
     static lv_color_t* buf2;
     static lv_indev_t* touch_indev;
+    static SemaphoreHandle_t vsync_sem;     // Donné par l'ISR VSYNC (mode DIRECT)
+    static bool swap_pending;               // Tampon remis au panneau, VSYNC attendu (tâche UI)
+
+    // Copie asynchrone (mode PARTIAL) : la tâche de copie sur le cœur 0 recopie
+    // la zone dans le framebuffer pendant que LVGL rend dans l'autre tampon
+    struct FlushJob {
+        lv_area_t area;
+        uint8_t* color_map;
+    };
+    static QueueHandle_t flush_queue;
+    static SemaphoreHandle_t flush_done_sem;
+    static int64_t copy_start_us;
+
+    // Trafic de rendu depuis le dernier relevé (tâche UI -> surveillance)
+    static std::atomic<uint32_t> flush_count;
+    static std::atomic<uint32_t> flush_bytes;
+    static std::atomic<uint32_t> swap_count;
+    static std::atomic<uint32_t> frame_count;   // Images balayées (VSYNC)
+    static std::atomic<uint32_t> copy_us;       // Durée des copies vers le framebuffer
+    static std::atomic<uint32_t> wait_us;       // Attente de LVGL sur une copie ou un VSYNC
+    static std::atomic<uint32_t> vsync_timeouts;
+
+    // Planification des zones invalidées (tâche UI), bilan lu par la surveillance
+    static DirtyPlanner planner;
+    static std::atomic<uint32_t> planned_frames;
+    static std::atomic<uint32_t> planned_areas_in;
+    static std::atomic<uint32_t> planned_areas_out;
+    static std::atomic<uint32_t> requested_px;
+    static std::atomic<uint32_t> planned_px;
+
+    // Tactile : l'interruption INT réveille la tâche de lecture I2C, qui dépose
+    // les échantillons dans une file sans verrou ; le rappel LVGL ne lit qu'elle
+    static TouchRing touch_ring;
+    static GestureDetector gestures;
+    static TaskHandle_t touch_task_handle;
+    static bool touch_irq_enabled;
+    static std::atomic<uint32_t> touch_irq_us;
+    static TouchSample touch_state;             // Dernier échantillon consommé (tâche UI)
+    static GestureCallback gesture_cb;
+    static void* gesture_ctx;
+    static TaskHandle_t input_task;             // Réveillée à chaque échantillon publié
+    static bool swallow_touch;                  // Tâche UI
+    static uint32_t pending_input_us;           // Entrée pas encore affichée (tâche UI)
+    static bool input_pending;
+    static std::atomic<uint32_t> touch_irqs;
+    static std::atomic<uint32_t> touch_reads;
+    static std::atomic<uint32_t> touch_errors;
+    static std::atomic<uint32_t> touch_gestures;
+    static std::atomic<uint32_t> latency_count;
+    static std::atomic<uint32_t> latency_sum_us;
+    static std::atomic<uint32_t> latency_max_us;
+    static std::atomic<uint32_t> invalidated_areas;
+    static std::atomic<uint32_t> render_count;
+    static std::atomic<uint32_t> render_us;
+    static int64_t render_start_us;
     
+    // Bus I2C partagé : tactile et expander CH422G (rétroéclairage, alimentation)
+    static I2cBus i2c_bus;
+    static uint8_t touch_dev;
+    static uint8_t expander_dev;
+    static bool exio_set_level(uint8_t exio, int level);
+    static bool exio_set_level_async(uint8_t exio, int level);
+
     // Driver callbacks
+    static uint32_t lvgl_tick_cb();
     static void lvgl_flush_cb(lv_display_t* display, const lv_area_t* area, uint8_t* color_map);
     static void lvgl_touch_cb(lv_indev_t* indev, lv_indev_data_t* data);
+    static void touch_isr(void* arg);
+    static void touch_task(void* arg);
+    static void record_input_latency();
+    static void lvgl_render_event_cb(lv_event_t* e);
+    static void lvgl_refr_start_cb(lv_event_t* e);
+    static bool on_vsync(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t* edata,
+                         void* user_ctx);
+    static bool on_color_trans_done(esp_lcd_panel_handle_t panel, void* user_ctx);
+    static void lvgl_flush_wait_cb(lv_display_t* display);
+    static void lvgl_vsync_wait_cb(lv_display_t* display);
+    static void flush_task(void* arg);
+    void copy_area(const FlushJob& job);
     
     // Configuration LCD
     bool configure_lcd_interface();
     bool configure_touch_interface();
     bool configure_lvgl();
+    bool configure_partial_buffers();
     
 public:
-    DisplayDriver();
+    explicit DisplayDriver(RenderMode mode = RenderMode::DIRECT, LcdProfile profile = LcdProfile::BALANCED);
     ~DisplayDriver();
     
     bool initialize();
-    void update();
+    // Retourne le délai avant la prochaine minuterie LVGL (lv_timer_handler)
+    uint32_t update();
     
     // Contrôles d'affichage
     void set_brightness(uint8_t brightness);  // 0-100%
@@ -88,7 +200,59 @@ public:
     // Informations d'affichage
     uint16_t get_width() const { return LCD_WIDTH; }
     uint16_t get_height() const { return LCD_HEIGHT; }
+    // Mode effectif : DIRECT retombe en PARTIAL si la PSRAM manque
+    RenderMode get_render_mode() const { return render_mode; }
+    // Profil effectif : retombe sur SAFE si la SRAM interne manque
+    LcdProfile get_lcd_profile() const { return lcd_profile; }
+    static const LcdTimingProfile& get_timing_profile(LcdProfile profile);
+    // Fréquence de balayage théorique du profil (porches compris)
+    static float get_refresh_hz(LcdProfile profile);
+
+    // Zones transmises et octets recopiés vers le framebuffer depuis le dernier
+    // appel (remis à zéro), échanges de framebuffers, zones invalidées et temps
+    // de rendu LVGL cumulé
+    struct RenderStats {
+        uint32_t flushes;
+        uint32_t bytes;
+        uint32_t swaps;
+        uint32_t frames;            // Images balayées par le panneau
+        uint32_t copy_us;           // Copies asynchrones (mode PARTIAL)
+        uint32_t wait_us;           // Part des copies (PARTIAL) ou du balayage (DIRECT) non recouverte
+        uint32_t vsync_timeouts;    // VSYNC attendu plus de 100 ms (DIRECT)
+        uint32_t planned_frames;    // Images passées par le planificateur
+        uint32_t areas_in;          // Zones invalidées avant / après fusion
+        uint32_t areas_out;
+        uint32_t requested_px;      // Pixels invalidés / rendus après alignement et fusion
+        uint32_t planned_px;
+        uint32_t refreshes;
+        uint32_t invalidated;
+        uint32_t render_us;
+    };
+    RenderStats take_render_stats();
     
+    // Tactile : échantillons consommés par LVGL et latence entrée -> flush
+    struct TouchStats {
+        uint32_t irqs;
+        uint32_t reads;             // Rafales I2C (tous les points d'un coup)
+        uint32_t errors;
+        uint32_t gestures;
+        uint32_t latency_count;
+        uint32_t latency_sum_us;
+        uint32_t latency_max_us;
+    };
+    TouchStats take_touch_stats();
+    // Bus I2C partagé, pour les capteurs du terrarium et le relevé de latence
+    I2cBus& get_i2c_bus() { return i2c_bus; }
+    // Tâche UI réveillée par le tactile : le périphérique LVGL passe en mode
+    // événement et n'est plus lu que par read_input()
+    void set_input_task(TaskHandle_t task);
+    bool has_pending_input() const { return !touch_ring.empty(); }
+    void read_input();
+    // Le toucher qui rallume l'écran n'atteint pas les widgets
+    void discard_touch_until_release();
+    // Gestes reconnus, remontés depuis la tâche UI (rappel de lecture LVGL)
+    void set_gesture_callback(GestureCallback callback, void* context);
+
     // Calibration tactile (si nécessaire)
     void calibrate_touch();
     bool is_touch_calibrated() const;
@@ -2,15 +2,44 @@
 
 #include "reptile_types.h"
 #include "lvgl.h"
+#include <mutex>
 #include <vector>
 
+// Événements importants : déclenchent une sauvegarde immédiate
+enum SaveEvent : uint32_t {
+    SAVE_EVENT_PURCHASE = 1 << 0,
+    SAVE_EVENT_DEATH = 1 << 1,
+    SAVE_EVENT_BREEDING = 1 << 2
+};
+
 class GameEngine {
 private:
     std::vector<Reptile> reptiles;
     uint32_t current_timestamp;
-    uint8_t selected_reptile_index;
+    uint16_t selected_reptile_index;
+    
+    // Enregistrements lus en place depuis l'image de sauvegarde projetée.
+    // Copiés dans `reptiles` seulement à la première modification.
+    const uint8_t* mapped_records;
+    size_t mapped_stride;
+    size_t mapped_count;
+    // Horodatage du dernier tick tant que la projection est en lecture seule
+    uint32_t mapped_tick_ms;
+    bool mapped_ticked;
+    // Tick : état simulé de chaque reptile, comparé à l'enregistrement stocké
+    std::vector<Reptile> tick_scratch;
+    
+    // Passage projection -> copie en RAM, ajout et retrait : la tâche UI
+    // tient ce verrou pendant qu'elle lit par peek_reptile()
+    mutable std::recursive_mutex storage_lock;
+    
+    // Changements depuis la dernière sauvegarde (politique d'autosauvegarde)
+    uint32_t change_weight;
+    uint32_t pending_events;
+    void mark_changed(uint32_t weight) { change_weight += weight; }
     
     // Systèmes de simulation avancés
+    void simulate_tick(Reptile& reptile);
     void update_physiology(Reptile& reptile, uint32_t delta_time);
     void update_behavior(Reptile& reptile);
     void update_growth(Reptile& reptile);
@@ -21,42 +50,59 @@ private:
     void process_aging(Reptile& reptile);
     
 public:
+    // Indices moteur sur 16 bits : seule borne de la collection
+    static constexpr size_t MAX_REPTILES = UINT16_MAX + 1;
+
     GameEngine();
     ~GameEngine();
     
     // Gestion des reptiles
     bool add_reptile(ReptileSpecies species, const char* name);
-    bool remove_reptile(uint8_t index);
-    Reptile* get_reptile(uint8_t index);
+    bool remove_reptile(uint16_t index);
+    Reptile* get_reptile(uint16_t index);
+    const Reptile* peek_reptile(uint16_t index) const;
     size_t get_reptile_count() const;
-    const std::vector<Reptile>& get_reptiles() const;
+    const std::vector<Reptile>& get_reptiles();
     void set_reptiles(const std::vector<Reptile>& reptiles);
     
+    // Chargement zéro copie
+    void attach_mapped_reptiles(const uint8_t* records, size_t stride, size_t count);
+    bool has_mapped_reptiles() const;
+    void materialize();
+    std::recursive_mutex& storage_mutex() const { return storage_lock; }
+    
     // Interactions de gameplay
-    bool feed_reptile(uint8_t index, FoodType food);
-    bool adjust_temperature(uint8_t index, float new_temp);
-    bool adjust_humidity(uint8_t index, float new_humidity);
-    bool toggle_lighting(uint8_t index);
-    bool clean_terrarium(uint8_t index);
-    bool handle_reptile(uint8_t index);
+    bool feed_reptile(uint16_t index, FoodType food);
+    bool adjust_temperature(uint16_t index, float new_temp);
+    bool adjust_humidity(uint16_t index, float new_humidity);
+    bool toggle_lighting(uint16_t index);
+    bool clean_terrarium(uint16_t index);
+    bool handle_reptile(uint16_t index);
     
     // Système de reproduction
-    bool can_breed(uint8_t female_index, uint8_t male_index);
-    bool initiate_breeding(uint8_t female_index, uint8_t male_index);
+    bool can_breed(uint16_t female_index, uint16_t male_index);
+    bool initiate_breeding(uint16_t female_index, uint16_t male_index);
     
     // Système de santé vétérinaire
-    bool diagnose_health_issue(uint8_t index);
-    bool treat_health_issue(uint8_t index, const char* treatment);
+    bool diagnose_health_issue(uint16_t index);
+    bool treat_health_issue(uint16_t index, const char* treatment);
     
     // Mise à jour du moteur de jeu
     void update(uint32_t delta_time_ms);
+    uint32_t get_current_timestamp() const { return current_timestamp; }
     
     // Événements aléatoires
     void trigger_random_events();
     
+    // Suivi des changements à sauvegarder
+    void mark_event(SaveEvent event) { pending_events |= event; }
+    uint32_t get_change_weight() const { return change_weight; }
+    uint32_t get_pending_events() const { return pending_events; }
+    void clear_changes();
+    
     // Sélection active
-    void select_reptile(uint8_t index);
-    uint8_t get_selected_reptile() const;
+    void select_reptile(uint16_t index);
+    uint16_t get_selected_reptile() const;
     
     // Statistiques
     uint32_t get_total_experience() const;
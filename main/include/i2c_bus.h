@@ -0,0 +1,47 @@
+#pragma once
+
+#include "i2c_scheduler.h"
+#include "driver/i2c_master.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define I2C_NO_DEVICE       0xFF
+
+// Bus I2C partagé (tactile, expander CH422G, capteurs à venir) sur le pilote
+// i2c_master. Une tâche dédiée du cœur 0 est seule à toucher le bus : les
+// autres tâches déposent des transactions et n'attendent jamais le bus, sauf
+// `transfer()`, réservé aux tâches d'entrée/sortie et à l'initialisation.
+class I2cBus {
+private:
+    i2c_master_bus_handle_t bus = nullptr;
+    i2c_master_dev_handle_t devices[I2C_MAX_DEVICES] = {};
+    const char* names[I2C_MAX_DEVICES] = {};
+    uint8_t device_count = 0;
+    uint32_t timeout_ms = 20;
+
+    I2cScheduler scheduler;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    TaskHandle_t task_handle = nullptr;
+    uint32_t rejected = 0;
+
+    static void bus_task(void* arg);
+    I2cStatus execute(const I2cRequest& request);
+
+public:
+    // `xfer_timeout_ms` : plafond d'une transaction sur le bus
+    bool begin(i2c_port_num_t port, gpio_num_t sda, gpio_num_t scl, uint32_t xfer_timeout_ms);
+    // Retourne l'index du périphérique, I2C_NO_DEVICE en cas d'échec
+    uint8_t add_device(uint16_t address, uint32_t scl_hz, const char* name);
+
+    // Non bloquant : false si la file est pleine
+    bool submit(const I2cRequest& request);
+    bool write_async(uint8_t device, const uint8_t* data, uint8_t len, I2cPriority priority);
+    // Bloque l'appelant (et lui seul) jusqu'à la fin de la transaction
+    I2cStatus transfer(uint8_t device, const uint8_t* tx, uint8_t tx_len, uint8_t* rx, uint16_t rx_len,
+                       I2cPriority priority);
+
+    // Relevé par périphérique depuis le dernier appel (remis à zéro)
+    I2cDeviceStats take_device_stats(uint8_t device);
+    void log_report();
+};
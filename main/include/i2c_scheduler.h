@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define I2C_TX_MAX          4       // Registre + quelques octets : commandes courtes
+#define I2C_QUEUE_LENGTH    16
+#define I2C_MAX_DEVICES     6
+
+// Ordre de service : le tactile passe avant l'expander (rétroéclairage,
+// alimentations), qui passe avant les capteurs du terrarium
+enum class I2cPriority : uint8_t {
+    TOUCH = 0,
+    EXPANDER,
+    SENSOR,
+    COUNT
+};
+
+enum class I2cStatus : uint8_t {
+    OK = 0,
+    ERROR,
+    TIMEOUT,
+    REJECTED        // File pleine ou périphérique inconnu
+};
+
+// Appelé depuis la tâche du bus une fois la transaction terminée
+typedef void (*I2cDoneCallback)(void* context, I2cStatus status);
+
+struct I2cRequest {
+    uint8_t device;                 // Index retourné à l'enregistrement
+    I2cPriority priority;
+    uint8_t tx_len;
+    uint8_t tx[I2C_TX_MAX];         // Copié : l'appelant n'a pas à le garder
+    uint8_t* rx;                    // Doit rester valide jusqu'au rappel
+    uint16_t rx_len;                // 0 : écriture seule
+    uint32_t submit_us;
+    I2cDoneCallback done;
+    void* context;
+};
+
+// Latence par périphérique, de la soumission à la fin du transfert
+struct I2cDeviceStats {
+    uint32_t transactions;
+    uint32_t merged;                // Écritures remplacées avant d'atteindre le bus
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t latency_sum_us;
+    uint32_t latency_max_us;
+    uint32_t bus_us;                // Part passée sur le bus
+};
+
+// Ordonnancement des transactions d'un bus partagé, sans dépendance FreeRTOS :
+// I2cBus le protège par une section critique et l'exécute dans sa tâche.
+// - priorité d'abord, ordre d'arrivée ensuite ;
+// - une écriture sans rappel vers le même registre d'un périphérique remplace
+//   celle encore en attente (seul le dernier niveau compte) ;
+// - à priorité égale, les écritures vers le périphérique qui vient d'être
+//   servi passent en premier, ce qui les enchaîne sans changer d'adresse.
+class I2cScheduler {
+public:
+    enum class PushResult : uint8_t {
+        QUEUED = 0,
+        MERGED,
+        FULL
+    };
+
+private:
+    struct Slot {
+        bool used;
+        uint32_t sequence;
+        I2cRequest request;
+    };
+
+    Slot slots[I2C_QUEUE_LENGTH] = {};
+    uint32_t next_sequence = 0;
+    uint8_t pending = 0;
+    I2cDeviceStats stats[I2C_MAX_DEVICES] = {};
+
+    static bool is_plain_write(const I2cRequest& request) {
+        return request.rx_len == 0 && request.done == nullptr && request.tx_len > 0;
+    }
+
+public:
+    PushResult push(const I2cRequest& request);
+    // `last_device` : périphérique servi juste avant (0xFF si aucun)
+    bool pop(I2cRequest& request, uint8_t last_device);
+    uint8_t size() const { return pending; }
+
+    void record(uint8_t device, uint32_t latency_us, uint32_t bus_us, I2cStatus status);
+    // Relevé remis à zéro
+    I2cDeviceStats take_stats(uint8_t device);
+};
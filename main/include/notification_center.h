@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum NotificationPriority : uint8_t {
+    NOTIF_INFO = 0,         // Retour d'action (alimentation, nettoyage...)
+    NOTIF_REMINDER,         // Rappels de soin
+    NOTIF_WARNING,          // Action refusée, situation à surveiller
+    NOTIF_CRITICAL          // Santé critique : préempte les autres toasts
+};
+
+// File de notifications sans allocation : quelques emplacements de toast
+// fixes, file d'attente par priorité, déduplication par clé et délai de
+// récupération par clé. Aucune dépendance LVGL : l'UI applique l'état des
+// emplacements aux widgets préalloués (voir UIManager::sync_toasts).
+class NotificationCenter {
+public:
+    static constexpr uint8_t SLOT_COUNT = 3;        // Toasts affichés simultanément
+    static constexpr uint8_t QUEUE_SIZE = 8;
+    static constexpr uint8_t COOLDOWN_KEYS = 16;
+    static constexpr size_t TEXT_SIZE = 96;
+
+    enum PostResult : uint8_t {
+        POSTED = 0,
+        DUPLICATE,          // Même clé déjà affichée ou en attente
+        COOLDOWN,           // Clé affichée trop récemment
+        DROPPED             // File pleine de messages plus prioritaires
+    };
+
+    struct Notification {
+        uint32_t key;
+        uint32_t sequence;          // Ordre d'arrivée à priorité égale
+        uint32_t duration_ms;
+        uint32_t cooldown_ms;
+        NotificationPriority priority;
+        char text[TEXT_SIZE];
+    };
+
+    struct Slot {
+        Notification notification;
+        uint32_t expires_ms;
+        bool active;
+        bool changed;               // À répercuter sur le widget
+    };
+
+    struct Stats {
+        uint32_t posted;
+        uint32_t shown;
+        uint32_t duplicates;
+        uint32_t cooldown_suppressed;
+        uint32_t dropped;
+        uint32_t preempted;
+    };
+
+private:
+    struct CooldownEntry {
+        uint32_t key;
+        uint32_t until_ms;
+    };
+
+    Slot slots[SLOT_COUNT] = {};
+    Notification queue[QUEUE_SIZE] = {};
+    uint8_t queued = 0;
+    CooldownEntry cooldowns[COOLDOWN_KEYS] = {};
+    uint8_t cooldown_count = 0;
+    uint32_t next_sequence = 0;
+    Stats stats = {};
+
+    bool in_cooldown(uint32_t key, uint32_t now_ms) const;
+    void start_cooldown(uint32_t key, uint32_t until_ms, uint32_t now_ms);
+    int8_t best_queued() const;
+    void show(Slot& slot, uint8_t queue_index, uint32_t now_ms);
+
+public:
+    // Clé stable (FNV-1a) : catégorie + sujet, ex. ("repas", nom du reptile)
+    static uint32_t make_key(const char* category, const char* subject = nullptr);
+
+    PostResult post(uint32_t key, const char* text, NotificationPriority priority,
+                    uint32_t now_ms, uint32_t duration_ms = 3000, uint32_t cooldown_ms = 0);
+
+    // Expiration, préemption et remplissage des emplacements libres.
+    // Retourne true si au moins un emplacement a changé.
+    bool tick(uint32_t now_ms);
+    // Masque les toasts visibles (la file d'attente est conservée)
+    void dismiss_all();
+
+    const Slot& slot(uint8_t index) const { return slots[index]; }
+    void acknowledge(uint8_t index) { slots[index].changed = false; }
+    bool slot_changed() const;
+    uint8_t visible_count() const;
+    uint8_t queued_count() const { return queued; }
+    bool has_pending() const { return queued != 0; }
+    // Délai avant la prochaine expiration en ms (UINT32_MAX si aucun toast)
+    uint32_t next_deadline(uint32_t now_ms) const;
+    const Stats& get_stats() const { return stats; }
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+// Cadence de la tâche UI et états d'alimentation de l'écran. La tâche dort
+// jusqu'à la prochaine échéance utile : minuterie LVGL (valeur de retour de
+// lv_timer_handler), relevé du modèle, fin de l'inertie tactile ou changement
+// d'état ; une entrée ou un changement du modèle la réveille plus tôt.
+// Aucune dépendance FreeRTOS ni LVGL : les temps sont fournis par l'appelant.
+class RenderGovernor {
+public:
+    enum class PowerState : uint8_t {
+        ACTIVE = 0,
+        DIM,            // Cadence d'image plafonnée
+        OFF             // Écran et rétroéclairage coupés, LVGL ne rend plus
+    };
+
+    struct Config {
+        uint32_t dim_after_ms;          // Inactivité avant DIM
+        uint32_t off_after_ms;          // Inactivité avant OFF
+        uint32_t model_period_ms;       // Relevé du modèle (barres, graphique)
+        uint32_t input_period_ms;       // Lecture tactile tant que l'entrée est récente
+        uint32_t input_tail_ms;         // Après la dernière entrée (inertie du défilement)
+        uint32_t dim_frame_ms;          // Intervalle minimal entre deux passes LVGL en DIM
+        uint32_t max_sleep_ms;
+    };
+
+    // Depuis le dernier relevé (remis à zéro)
+    struct Stats {
+        uint32_t wakeups;
+        uint32_t input_wakeups;
+        uint32_t lvgl_runs;
+        uint32_t awake_us;              // Tâche UI éveillée, attentes VSYNC et copie comprises : pas une charge CPU
+        uint32_t transitions;
+    };
+
+private:
+    Config config = {60000, 300000, 1000, 33, 1000, 100, 1000};
+    PowerState state = PowerState::ACTIVE;
+    uint32_t last_input_ms = 0;
+    uint32_t last_model_ms = 0;
+    uint32_t last_lvgl_ms = 0;
+    bool model_dirty = true;
+
+    std::atomic<uint32_t> wakeups{0};
+    std::atomic<uint32_t> input_wakeups{0};
+    std::atomic<uint32_t> lvgl_runs{0};
+    std::atomic<uint32_t> awake_us{0};
+    std::atomic<uint32_t> transitions{0};
+
+    static uint32_t elapsed(uint32_t now_ms, uint32_t since_ms) { return now_ms - since_ms; }
+
+public:
+    void configure(const Config& governor_config, uint32_t now_ms);
+    const Config& get_config() const { return config; }
+
+    // Entrée utilisateur : retour en ACTIVE. true si l'écran était éteint :
+    // le toucher qui le rallume ne doit pas atteindre les widgets
+    bool on_input(uint32_t now_ms);
+    // Changement du modèle signalé par le moteur de jeu
+    void on_model_change() { model_dirty = true; }
+
+    // Applique les délais d'inactivité ; true si l'état a changé
+    bool update_state(uint32_t now_ms);
+    PowerState get_state() const { return state; }
+
+    // Lecture tactile à cadence fixe pendant et juste après une entrée
+    bool input_active(uint32_t now_ms) const;
+    bool model_due(uint32_t now_ms) const;
+    void model_done(uint32_t now_ms);
+    // LVGL à exécuter maintenant (jamais en OFF, plafonné en DIM)
+    bool lvgl_due(uint32_t now_ms) const;
+    void lvgl_done(uint32_t now_ms);
+
+    // Sommeil jusqu'à la prochaine échéance ; `lvgl_next_ms` est la valeur de
+    // retour de lv_timer_handler (UINT32_MAX : aucune minuterie prête)
+    uint32_t next_sleep_ms(uint32_t now_ms, uint32_t lvgl_next_ms) const;
+
+    void record_wakeup(bool input, uint32_t awake_us);
+    Stats take_stats();
+
+    static const char* state_name(PowerState power_state);
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "game_engine.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+enum class ReptileSort : uint8_t {
+    NAME = 0,
+    SPECIES,
+    HEALTH,         // Santé croissante : les plus faibles en tête
+    URGENCY         // Urgence décroissante
+};
+
+enum class ReptileFilter : uint8_t {
+    ALL = 0,
+    CRITICAL,       // Santé < 30
+    WARNING,        // Santé < 60
+    URGENT          // Score d'urgence >= URGENT_THRESHOLD
+};
+
+// Score d'urgence 0-100 : faim, déshydratation, stress et santé dégradée
+uint8_t reptile_urgency(const Reptile& reptile);
+
+// Ordre d'affichage de la liste des reptiles : indices moteur triés et
+// filtrés (2 octets par reptile), reconstruit seulement quand le tri, le
+// filtre ou la population change. Quand le tri ou le filtre porte sur des
+// valeurs vivantes (santé, urgence), chaque relevé recalcule les clés d'une
+// tranche bornée de reptiles et ne repositionne que ceux dont la clé a
+// bougé. Lecture seule via peek_reptile.
+class ReptileListModel {
+public:
+    static constexpr int16_t ALL_SPECIES = -1;
+    static constexpr uint8_t URGENT_THRESHOLD = 50;
+    // Reptiles relus par relevé : coût constant quelle que soit la population
+    static constexpr size_t LIVE_SCAN_PER_REFRESH = 1024;
+
+private:
+    // Clés de tri et de filtre en cache (3 octets par reptile)
+    struct RowKey {
+        uint8_t species;
+        uint8_t health;
+        uint8_t urgency;
+    };
+
+    std::vector<uint16_t> order;
+    std::vector<uint16_t> next_order;   // Reconstruction, comparée à `order`
+    std::vector<RowKey> keys;           // Par indice moteur
+    ReptileSort sort = ReptileSort::NAME;
+    ReptileFilter filter = ReptileFilter::ALL;
+    int16_t species = ALL_SPECIES;
+    size_t source_count = 0;
+    size_t scan_cursor = 0;
+    bool stale = true;
+
+    static RowKey make_key(const Reptile& reptile);
+    bool accepts(const RowKey& key) const;
+    bool before(uint16_t a, uint16_t b, const GameEngine& engine) const;
+    bool rebuild(const GameEngine& engine, size_t count);
+    // Retire puis réinsère une ligne ; retourne true si l'ordre a changé
+    bool reposition(uint16_t index, const GameEngine& engine);
+
+public:
+    void set_sort(ReptileSort value);
+    void set_filter(ReptileFilter value);
+    void set_species(int16_t value);
+    void mark_stale() { stale = true; }
+    // Tri ou filtre sur la santé ou l'urgence : l'ordre suit la simulation
+    bool depends_on_live_values() const;
+
+    // Reconstruit l'ordre si nécessaire ; retourne true s'il a changé
+    bool refresh(const GameEngine& engine);
+
+    size_t size() const { return order.size(); }
+    uint16_t engine_index(size_t row) const { return order[row]; }
+    ReptileSort get_sort() const { return sort; }
+    ReptileFilter get_filter() const { return filter; }
+    int16_t get_species() const { return species; }
+};
+
+// Fenêtre de défilement virtualisée : un pool fixe d'emplacements de ligne
+// (lignes visibles + marge de part et d'autre) recyclés au fil du
+// défilement. L'élément i occupe toujours l'emplacement i % pool : une ligne
+// qui reste visible n'est jamais reliée à nouveau.
+class VirtualWindow {
+public:
+    static constexpr uint8_t MAX_POOL = 24;
+    static constexpr int32_t NO_ITEM = -1;
+
+private:
+    int32_t slot_items[MAX_POOL];
+    bool dirty[MAX_POOL];
+    uint16_t row_height = 1;
+    uint8_t overscan = 0;
+    uint8_t pool = 0;
+    size_t first_item = 0;
+    size_t end_item = 0;
+    uint32_t rebinds = 0;
+
+public:
+    VirtualWindow();
+
+    void configure(uint16_t row_px, uint16_t viewport_px, uint8_t overscan_rows);
+    // Recalcule la fenêtre ; retourne le nombre d'emplacements à relier
+    uint8_t update(int32_t scroll_y, size_t item_count);
+    // Force la liaison de tous les emplacements (après tri ou filtrage)
+    void invalidate();
+
+    uint8_t pool_size() const { return pool; }
+    size_t first() const { return first_item; }
+    size_t end() const { return end_item; }
+    int32_t slot_item(uint8_t slot) const { return slot_items[slot]; }
+    bool is_dirty(uint8_t slot) const { return dirty[slot]; }
+    void clear_dirty(uint8_t slot) { dirty[slot] = false; }
+    int32_t content_height(size_t item_count) const { return (int32_t)(item_count * row_height); }
+    uint32_t get_rebinds() const { return rebinds; }
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "lvgl.h"
+#include "reptile_list.h"
+
+// Liste virtualisée des reptiles (SCREEN_REPTILE_SELECT) : seules les lignes
+// de la fenêtre VirtualWindow existent en objets LVGL ; un objet d'espacement
+// donne la hauteur totale au conteneur défilant. Mémoire LVGL et coût par
+// image indépendants du nombre de reptiles.
+class ReptileListView {
+public:
+    typedef void (*SelectCallback)(void* context, uint16_t engine_index);
+
+    static constexpr uint16_t ROW_HEIGHT = 56;
+    static constexpr uint8_t OVERSCAN = 2;
+    static constexpr uint32_t REFRESH_MS = 1000;   // Valeurs vivantes des lignes visibles
+
+    struct Row {
+        lv_obj_t* obj;
+        lv_obj_t* name_label;
+        lv_obj_t* detail_label;
+        uint8_t urgency_level;      // Couleur appliquée (0 normal, 1 surveiller, 2 urgent)
+    };
+
+    struct Stats {
+        uint32_t rebuilds;          // Reconstructions de l'ordre (tri, filtre, population)
+        uint32_t last_rebuild_us;
+        uint32_t row_rebinds;
+        uint32_t label_writes;
+    };
+
+private:
+    GameEngine* engine;
+    SelectCallback on_select;
+    void* select_context;
+
+    ReptileListModel model;
+    VirtualWindow window;
+    Row rows[VirtualWindow::MAX_POOL];
+    lv_obj_t* container;
+    lv_obj_t* spacer;
+    lv_obj_t* count_label;
+    uint32_t last_refresh_ms;
+    Stats stats;
+
+    void bind_row(uint8_t slot, bool force);
+    void sync_window(bool force);
+    // Retourne true si l'ordre a été reconstruit (et les lignes reliées)
+    bool refresh_order();
+
+    static void on_scroll(lv_event_t* e);
+    static void on_row_click(lv_event_t* e);
+    static void on_sort_changed(lv_event_t* e);
+    static void on_filter_changed(lv_event_t* e);
+    static void on_species_changed(lv_event_t* e);
+
+public:
+    ReptileListView(GameEngine* engine, SelectCallback callback, void* context);
+
+    // Construit les contrôles et le pool de lignes dans `parent`
+    void create(lv_obj_t* parent, lv_coord_t x, lv_coord_t y, lv_coord_t width, lv_coord_t height);
+    // L'écran parent a été supprimé (éviction du cache d'écrans)
+    void detach();
+    bool is_created() const { return container != nullptr; }
+
+    // Appelé à chaque image quand l'écran est affiché : coût borné par le pool
+    void update(uint32_t now_ms);
+
+    uint8_t live_rows() const { return window.pool_size(); }
+    size_t listed_count() const { return model.size(); }
+    const Stats& get_stats() const { return stats; }
+};
@@ -17,6 +17,9 @@ enum class ReptileSpecies : uint8_t {
     IGUANA_IGUANA              // Iguane vert
 };
 
+// Nombre d'espèces : borne de SPECIES_DATABASE et des boucles sur ReptileSpecies
+constexpr uint8_t REPTILE_SPECIES_COUNT = static_cast<uint8_t>(ReptileSpecies::IGUANA_IGUANA) + 1;
+
 // États physiologiques critiques
 enum class LifeStage : uint8_t {
     EGG = 0,
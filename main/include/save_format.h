@@ -0,0 +1,178 @@
+#pragma once
+
+#include "reptile_types.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Format d'image de sauvegarde : lisible en place depuis la flash projetée
+// (esp_partition_mmap sur cible, mmap(2) sur hôte), sans copie intermédiaire.
+//
+//   [SaveImageHeader][SaveSectionEntry x section_count] ... [section alignée]...
+//
+// Chaque section est alignée sur SAVE_IMAGE_ALIGN et contient des
+// enregistrements à pas fixe (record_stride), accessibles par index.
+//
+// Depuis la v3, l'en-tête et la table des sections sont protégés par un
+// CRC-32C, et chaque enregistrement porte son propre CRC-32C : un
+// enregistrement corrompu est écarté sans invalider les autres. Les
+// sections brutes (record_stride = 0, données des composants) sont suivies
+// d'un CRC-32C de leurs `size` octets.
+
+#define SAVE_IMAGE_MAGIC        0x52455054  // "REPT"
+#define SAVE_FORMAT_VERSION     3
+#define SAVE_FORMAT_MAPPED_V2   2           // Somme de contrôle globale
+#define SAVE_FORMAT_LEGACY      1
+#define SAVE_IMAGE_ALIGN        32          // ligne de cache ESP32-S3
+
+// La disposition de Reptile fait partie du format persistant
+static_assert(sizeof(Reptile) == 96, "Modifier Reptile impose une nouvelle version de format");
+
+enum SaveSectionId : uint16_t {
+    SAVE_SECTION_REPTILES = 1
+};
+
+struct SaveImageHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;       // sizeof(SaveImageHeader)
+    uint32_t image_size;        // Taille totale de l'image (octets)
+    uint32_t sequence;          // Compteur monotone de sauvegarde
+    uint32_t timestamp;         // ms depuis le démarrage
+    uint16_t section_count;
+    uint16_t reserved;
+    uint32_t checksum;          // v3 : CRC-32C en-tête + table ; v2 : tout ce qui suit l'en-tête
+    uint32_t padding;
+};
+static_assert(sizeof(SaveImageHeader) == 32, "En-tête persistant");
+
+// Table des sections (offset table)
+struct SaveSectionEntry {
+    uint16_t id;
+    uint16_t record_stride;     // Pas d'un enregistrement (0 = section brute)
+    uint32_t offset;            // Depuis le début de l'image
+    uint32_t record_count;
+    uint32_t size;              // Taille utile de la section
+};
+static_assert(sizeof(SaveSectionEntry) == 16, "Entrée de table persistante");
+
+// Enregistrement reptile v3
+struct SaveReptileRecord {
+    Reptile reptile;
+    uint32_t crc;               // CRC-32C de `reptile`
+};
+
+// En-tête du format v1 (blob NVS "reptile_data"), conservé pour la migration
+struct LegacySaveHeader {
+    uint32_t version;
+    uint32_t timestamp;
+    uint16_t reptile_count;
+    uint32_t checksum;
+};
+
+// Somme de contrôle historique v1/v2 (décalage-xor)
+uint32_t save_checksum(const uint8_t* data, size_t size);
+
+// CRC de l'en-tête v3 (champ checksum exclu) et de sa table des sections
+uint32_t save_header_crc(const SaveImageHeader& header, const SaveSectionEntry* sections);
+
+// Encodage
+size_t save_record_stride();
+size_t save_image_size(size_t reptile_count);
+
+// Accès direct aux enregistrements d'une image plate à section unique,
+// pour les tampons mis à jour en place (sauvegarde d'urgence)
+size_t save_record_offset(size_t index);
+void encode_reptile_record(const Reptile& reptile, uint8_t* record);
+size_t seal_save_image(uint8_t* image, size_t count, uint32_t sequence, uint32_t timestamp);
+
+// Image complète dans un tampon plat (outils hôte, tampons préalloués)
+size_t encode_save_image(const Reptile* reptiles, size_t count,
+                         uint32_t sequence, uint32_t timestamp,
+                         uint8_t* out, size_t out_size);
+
+// Sérialiseur en flux à mémoire constante : les octets sont encodés dans un
+// anneau de blocs fixes et chaque bloc plein est transmis au support sous
+// forme de segment numéroté. L'en-tête et la table des sections, connus
+// seulement à la fin, sont écrits en dernier : une image interrompue ne
+// porte pas d'en-tête valide.
+class SaveStreamWriter {
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr size_t CHUNK_COUNT = 2;
+    static constexpr uint16_t MAX_SECTIONS = 8;
+
+    // Écrit `size` octets à `offset` dans l'image ; le bloc reste valide
+    // jusqu'au remplissage du bloc suivant de l'anneau.
+    typedef bool (*SinkFn)(void* ctx, uint32_t segment, size_t offset, const uint8_t* data, size_t size);
+
+private:
+    uint8_t chunks[CHUNK_COUNT][CHUNK_SIZE];
+    uint8_t current_chunk = 0;
+    size_t chunk_fill = 0;
+    size_t chunk_offset = 0;
+    uint32_t segment = 0;
+
+    SinkFn sink = nullptr;
+    void* sink_ctx = nullptr;
+    SaveSectionEntry sections[MAX_SECTIONS];
+    uint16_t section_count = 0;
+    uint16_t declared_sections = 0;
+    bool section_open = false;
+    bool failed = false;
+    uint32_t section_crc = 0;
+
+    size_t position() const { return chunk_offset + chunk_fill; }
+    bool put(const void* data, size_t size);
+    bool flush_chunk();
+
+public:
+    void begin(SinkFn sink_fn, void* ctx, uint16_t sections_expected);
+    bool begin_section(uint16_t id, uint16_t record_stride);
+    bool append(const void* data, size_t size);
+    bool append_reptile(const Reptile& reptile);
+    void end_section();
+    bool finish(uint32_t sequence, uint32_t timestamp);
+
+    size_t image_size() const { return position(); }
+    uint32_t get_segment_count() const { return segment; }
+    static constexpr size_t buffer_bytes() { return CHUNK_SIZE * CHUNK_COUNT; }
+};
+
+// Décodage du blob v1
+bool decode_legacy_save(const uint8_t* blob, size_t size, std::vector<Reptile>& reptiles);
+
+// Vue en lecture seule sur une image projetée : aucune copie, les
+// enregistrements sont lus directement depuis la mémoire fournie.
+class SaveImageView {
+private:
+    const uint8_t* base = nullptr;
+    const SaveImageHeader* hdr = nullptr;
+    const SaveSectionEntry* reptile_section = nullptr;
+
+public:
+    // Valide l'en-tête, la table des sections et les bornes de la projection
+    bool open(const uint8_t* data, size_t mapped_size);
+    void close();
+    bool is_valid() const { return hdr != nullptr; }
+
+    const SaveImageHeader* header() const { return hdr; }
+    const SaveSectionEntry* find_section(uint16_t id) const;
+    uint16_t section_count() const { return hdr ? hdr->section_count : 0; }
+    const SaveSectionEntry* section_at(uint16_t index) const;
+    const uint8_t* section_data(const SaveSectionEntry& section) const;
+
+    // Section brute intacte (CRC de fin de section)
+    bool section_valid(const SaveSectionEntry& section) const;
+
+    size_t reptile_count() const;
+    size_t reptile_stride() const;
+    const uint8_t* reptile_records() const;
+    const Reptile* reptile(size_t index) const;
+
+    // Intégrité par enregistrement (toujours vrai pour une image v2)
+    bool record_valid(size_t index) const;
+    size_t count_valid_records() const;
+    // Copie des enregistrements intacts ; renvoie le nombre d'écartés
+    size_t copy_valid_reptiles(std::vector<Reptile>& reptiles) const;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#endif
+
+// Partition de données "savedata" découpée en slots de taille fixe.
+// Les slots primaires alternent (A/B) pour qu'une image projetée reste
+// valide pendant l'écriture de la suivante.
+class SavePartition {
+public:
+    static constexpr const char* PARTITION_LABEL = "savedata";
+    static constexpr size_t SECTOR_SIZE = 4096;
+    static constexpr size_t SLOT_SIZE = 64 * 1024;
+    static constexpr uint8_t SLOT_COUNT = 4;
+
+    enum Slot : uint8_t {
+        SLOT_PRIMARY_A = 0,
+        SLOT_PRIMARY_B,
+        SLOT_BACKUP,
+        SLOT_EMERGENCY
+    };
+
+private:
+#ifdef ESP_PLATFORM
+    const esp_partition_t* partition = nullptr;
+    esp_partition_mmap_handle_t mmap_handle = 0;
+#else
+    static const char* host_path;
+    int fd = -1;
+    uint8_t* host_map = nullptr;
+#endif
+    const uint8_t* mapped = nullptr;
+    uint8_t mapped_slot = SLOT_COUNT;
+
+public:
+    SavePartition() = default;
+    ~SavePartition();
+
+    bool open();
+    void close();
+    bool is_open() const;
+
+    // Efface les secteurs couvrant les `size` premiers octets du slot
+    bool erase_slot(uint8_t slot, size_t size = SLOT_SIZE);
+    // Efface les secteurs couvrant [offset, offset + size), offset aligné secteur
+    bool erase_range(uint8_t slot, size_t offset, size_t size);
+    bool write(uint8_t slot, size_t offset, const void* data, size_t size);
+    bool read(uint8_t slot, size_t offset, void* data, size_t size) const;
+    bool copy_slot(uint8_t from, uint8_t to, size_t size);
+
+    // Projection en lecture seule d'un slot (une seule projection active)
+    const uint8_t* map_slot(uint8_t slot);
+    void unmap();
+    uint8_t get_mapped_slot() const { return mapped_slot; }
+
+#ifndef ESP_PLATFORM
+    // Fichier image utilisé à la place de la partition sur hôte
+    static void set_host_path(const char* path);
+#endif
+};
@@ -2,7 +2,13 @@
 
 #include "nvs_flash.h"
 #include "nvs.h"
+#include "persistence.h"
+#include "autosave_policy.h"
 #include "reptile_types.h"
+#include "save_format.h"
+#include "save_partition.h"
+#include "save_telemetry.h"
+#include <mutex>
 #include <vector>
 
 class GameEngine; // Forward declaration
@@ -11,9 +17,54 @@ class SaveSystem {
 private:
     nvs_handle_t nvs_handle = 0;
     bool is_initialized = false;
-    uint32_t save_version = 1;
+    uint32_t save_version = SAVE_FORMAT_VERSION;
     GameEngine* game_engine = nullptr;
     
+    // Images de sauvegarde en partition (slots A/B)
+    SavePartition partition;
+    uint8_t active_slot = SavePartition::SLOT_PRIMARY_A;
+    uint32_t save_sequence = 0;
+    size_t active_image_size = 0;
+    
+    // Sérialisation en flux (tampons fixes, hors pile de la tâche appelante)
+    SaveStreamWriter writer;
+    uint8_t stream_slot = 0;
+    size_t stream_erased = 0;
+    uint32_t stream_heap_start = 0;
+    uint32_t stream_heap_min = 0;
+    uint32_t stream_write_us = 0;
+    static bool partition_sink(void* ctx, uint32_t segment, size_t offset,
+                               const uint8_t* data, size_t size);
+    
+    // Image d'urgence pré-sérialisée, tenue à jour par refresh_emergency_image()
+    // sur la tâche de jeu. emergency_save() peut venir d'une autre tâche : il
+    // ne lit que les champs warm_*, tous protégés par warm_lock.
+    uint8_t* warm_image = nullptr;
+    size_t warm_capacity = 0;
+    size_t warm_count = 0;
+    bool warm_valid = false;
+    bool warm_dirty = false;            // Modifiée depuis la dernière écriture d'urgence
+    uint32_t warm_sequence = 0;         // Copie de save_sequence au dernier rafraîchissement
+    size_t warm_erased = 0;             // Octets effacés, imputés à l'usure au rafraîchissement
+    std::mutex warm_lock;
+    bool recover_emergency_image();
+    
+    // Sections des composants, écrites avec les reptiles dans la même image
+    PersistenceRegistry sections;
+    void attach_sections(const SaveImageView& view);
+    
+    // Politique d'autosauvegarde (budget d'usure flash)
+    AutosavePolicy autosave_policy;
+    void update_wear_stats();
+    
+    // Télémétrie d'E/S (phases, octets par clé, occupation NVS)
+    SaveTelemetry telemetry;
+    // Statistiques, télémétrie et politique d'usure : tenu par la tâche de
+    // jeu pendant chaque sauvegarde, pris par log_io_report() (surveillance,
+    // cœur 0) et par emergency_save() pour ses comptes. Avant warm_lock.
+    mutable std::recursive_mutex io_lock;
+    esp_err_t write_key(const char* key, const void* data, size_t size);
+    
     // Clés de sauvegarde
     static const char* NVS_NAMESPACE;
     static const char* KEY_REPTILE_COUNT;
@@ -21,26 +72,21 @@ private:
     static const char* KEY_GAME_SETTINGS;
     static const char* KEY_SAVE_VERSION;
     static const char* KEY_LAST_SAVE_TIME;
+    static const char* KEY_ACTIVE_SLOT;
+    static const char* KEY_FLASH_WEAR;
     static const char* KEY_REPTILE_COUNT_BACKUP;
     static const char* KEY_REPTILE_DATA_BACKUP;
     static const char* KEY_SAVE_VERSION_BACKUP;
     static const char* KEY_LAST_SAVE_TIME_BACKUP;
     
-    // Données de sauvegarde compressées
-    struct SaveHeader {
-        uint32_t version;
-        uint32_t timestamp;
-        uint16_t reptile_count;
-        uint32_t checksum;
-    };
-    
-    // Compression/décompression simple
-    size_t compress_reptile_data(const std::vector<Reptile>& reptiles, uint8_t* buffer, size_t buffer_size);
-    bool decompress_reptile_data(const uint8_t* buffer, size_t buffer_size, std::vector<Reptile>& reptiles);
+    // Projection de l'image active
+    bool map_active_image(SaveImageView& view);
+    void release_mapping();
+    uint8_t inactive_slot() const;
     
-    // Vérification d'intégrité
-    uint32_t calculate_checksum(const uint8_t* data, size_t size);
-    bool verify_data_integrity(const uint8_t* data, size_t size, uint32_t expected_checksum);
+    // Format v1 (blob NVS) - migration uniquement
+    bool load_legacy_reptiles(std::vector<Reptile>& reptiles);
+    void erase_legacy_keys();
     
 public:
     SaveSystem(GameEngine* engine = nullptr);
@@ -48,6 +94,9 @@ public:
     
     bool initialize();
     
+    // À appeler avant load_game_data() pour recevoir la vue de sa section
+    bool register_section(PersistentSection* section);
+    
     // Sauvegarde/chargement principal
     bool save_game_data();
     bool load_game_data();
@@ -56,14 +105,18 @@ public:
     bool save_reptiles(const std::vector<Reptile>& reptiles);
     bool load_reptiles(std::vector<Reptile>& reptiles);
     
-    // Gestion automatique
+    // Gestion automatique : appelée à chaque tick, la politique décide
     void auto_save();
+    AutosavePolicy& get_autosave_policy() { return autosave_policy; }
     void emergency_save();
+    void refresh_emergency_image();
     
     // Utilitaires
     bool has_save_data() const;
     uint32_t get_last_save_time() const;
     size_t get_save_size() const;
+    const SaveTelemetry& get_telemetry() const { return telemetry; }
+    void log_io_report();
     
     // Maintenance
     bool backup_save();
@@ -77,6 +130,29 @@ public:
         uint32_t failed_saves{0};
         uint32_t last_save_duration_ms{0};
         size_t save_data_size{0};
+        uint32_t recovered_records{0};   // Reptiles intacts repris d'une image partiellement corrompue
+        uint32_t dropped_records{0};     // Enregistrements écartés (CRC invalide)
+        uint32_t dropped_sections{0};    // Sections de composant corrompues
+        uint8_t last_save_sections{0};   // Sections de composant dans la dernière image
+        uint32_t last_save_segments{0};  // Segments écrits par la dernière sauvegarde
+        size_t stream_buffer_bytes{0};   // Tampons du sérialiseur (constant)
+        uint32_t peak_heap_bytes{0};     // Pic de tas consommé pendant l'écriture (cible)
+        uint32_t min_free_stack_bytes{0}; // Marge de pile minimale de la tâche (cible)
+        uint32_t emergency_saves{0};
+        uint32_t emergency_skipped{0};   // Demandes sans changement depuis la dernière écriture
+        uint32_t emergency_last_us{0};   // Durée de la dernière sauvegarde d'urgence
+        uint32_t emergency_max_us{0};    // Pire durée observée
+        size_t emergency_buffer_bytes{0}; // Tampon d'urgence préalloué (borne mémoire)
+        uint32_t warm_records_updated{0}; // Enregistrements réencodés par rafraîchissement
+        uint8_t autosave_last_decision{0}; // AutosavePolicy::Decision
+        uint32_t autosave_writes{0};
+        uint32_t autosave_forced{0};     // Sauvegardes sur événement important
+        uint32_t autosave_deferred{0};   // Reportées faute de budget
+        uint32_t autosave_skipped{0};    // Rien ou trop peu à sauvegarder
+        uint64_t flash_erased_bytes{0};  // Cumul persistant des octets effacés (slots A/B)
+        uint32_t flash_wear_millicycles{0}; // Cycles moyens consommés par secteur (x1000)
+        uint64_t daily_budget_bytes{0};
+        uint32_t projected_lifetime_days{0}; // Au rythme d'écriture de la session
     };
 
     SaveStats statistics{};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "nvs.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Histogramme à échelle logarithmique (puissances de 2 en microsecondes) :
+// enregistrement en O(1), mémoire fixe, percentiles approchés à la
+// borne haute du seau.
+class LogHistogram {
+public:
+    static constexpr uint8_t BUCKET_COUNT = 24; // [0,1] µs ... >= 4,2 s
+
+private:
+    uint32_t buckets[BUCKET_COUNT] = {};
+    uint32_t samples = 0;
+    uint32_t max_value = 0;
+    uint64_t total = 0;
+
+public:
+    void record(uint32_t value_us);
+    void reset();
+
+    uint32_t count() const { return samples; }
+    uint32_t max() const { return max_value; }
+    uint32_t mean() const { return samples ? (uint32_t)(total / samples) : 0; }
+    uint32_t bucket(uint8_t index) const { return index < BUCKET_COUNT ? buckets[index] : 0; }
+    // Borne haute du seau contenant le percentile `pct` (0-100)
+    uint32_t percentile(uint8_t pct) const;
+    static uint32_t bucket_limit(uint8_t index);
+};
+
+enum SavePhase : uint8_t {
+    SAVE_PHASE_SNAPSHOT = 0,    // Copie des reptiles du moteur
+    SAVE_PHASE_ENCODE,          // Sérialisation (hors écriture)
+    SAVE_PHASE_WRITE,           // Effacement + écriture partition
+    SAVE_PHASE_COMMIT,          // Métadonnées NVS + nvs_commit
+    SAVE_PHASE_COUNT
+};
+
+// Télémétrie d'E/S du système de sauvegarde, assez légère pour rester
+// active en production : compteurs et histogrammes fixes, aucune allocation.
+class SaveTelemetry {
+public:
+    static constexpr uint8_t MAX_KEYS = 8;
+    // Pseudo-clés pour les écritures en partition
+    static constexpr const char* KEY_IMAGE = "<image>";
+    static constexpr const char* KEY_EMERGENCY = "<urgence>";
+
+    struct KeyBytes {
+        const char* key;        // Pointeur statique (clés constantes)
+        uint32_t writes;
+        uint64_t bytes;
+        uint32_t last_size;
+    };
+
+private:
+    LogHistogram phases[SAVE_PHASE_COUNT];
+    KeyBytes keys[MAX_KEYS] = {};
+    uint8_t key_count = 0;
+    nvs_stats_t nvs_usage = {};
+    bool nvs_usage_valid = false;
+
+public:
+    void record_phase(SavePhase phase, uint32_t duration_us);
+    void record_key_write(const char* key, size_t bytes);
+    // Occupation des pages NVS (nvs_get_stats)
+    bool refresh_nvs_usage(const char* partition_label = nullptr);
+    void reset();
+
+    const LogHistogram& phase(SavePhase p) const { return phases[p]; }
+    const KeyBytes* find_key(const char* key) const;
+    uint8_t get_key_count() const { return key_count; }
+    const KeyBytes& get_key(uint8_t index) const { return keys[index]; }
+    // Dernière taille écrite de chaque clé : taille actuelle de la sauvegarde
+    size_t current_size() const;
+    uint64_t total_bytes() const;
+    const nvs_stats_t* get_nvs_usage() const { return nvs_usage_valid ? &nvs_usage : nullptr; }
+
+    static const char* phase_name(SavePhase p);
+    void log_report() const;
+};
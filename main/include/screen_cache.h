@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// Cache LRU des écrans LVGL construits à la demande. Chaque écran mémorise
+// son empreinte mesurée à la construction ; au-delà du budget, les écrans
+// les moins récemment affichés sont évincés puis reconstruits au besoin.
+// Aucune dépendance LVGL : UIManager construit et détruit les objets.
+class ScreenCache {
+public:
+    static constexpr uint8_t MAX_SCREENS = 8;
+    static constexpr int8_t NONE = -1;
+
+    struct Entry {
+        bool built;
+        bool pinned;                // Jamais évincé (écran principal)
+        uint32_t bytes;             // Dernière empreinte mesurée
+        uint32_t last_used;         // Horloge logique LRU
+        uint32_t build_us_last;
+        uint32_t build_us_max;
+        uint16_t builds;
+        uint16_t evictions;
+    };
+
+private:
+    Entry entries[MAX_SCREENS] = {};
+    uint8_t count;
+    uint32_t budget;
+    uint32_t clock = 0;
+
+public:
+    ScreenCache(uint8_t screen_count, uint32_t budget_bytes);
+
+    void set_budget(uint32_t budget_bytes) { budget = budget_bytes; }
+    uint32_t get_budget() const { return budget; }
+    void pin(uint8_t id);
+
+    void touch(uint8_t id);
+    void record_build(uint8_t id, uint32_t bytes, uint32_t build_us);
+    void record_eviction(uint8_t id);
+
+    // Écran à évincer pour que `incoming` tienne dans le budget (empreinte
+    // estimée d'après sa dernière construction), NONE s'il n'y a rien à faire
+    // ou plus rien d'évinçable. `current` reste affiché : jamais évincé.
+    int8_t next_victim(uint8_t incoming, uint8_t current) const;
+
+    bool is_built(uint8_t id) const { return id < count && entries[id].built; }
+    uint32_t resident_bytes() const;
+    uint8_t resident_count() const;
+    const Entry& entry(uint8_t id) const { return entries[id]; }
+    uint8_t size() const { return count; }
+};
@@ -57,7 +57,7 @@ struct SpeciesData {
 };
 
 // Base de données complète des espèces
-extern const SpeciesData SPECIES_DATABASE[10];
+extern const SpeciesData SPECIES_DATABASE[REPTILE_SPECIES_COUNT];
 
 // Fonctions utilitaires
 const SpeciesData& get_species_data(ReptileSpecies species);
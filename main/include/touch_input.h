@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Contrôleur FT5x06 : jusqu'à 5 points, registres lus d'un bloc depuis TD_STATUS
+#define FT5X06_REG_TD_STATUS    0x02
+#define FT5X06_MAX_POINTS       5
+#define FT5X06_POINT_BYTES      6
+#define FT5X06_BURST_BYTES      (1 + FT5X06_MAX_POINTS * FT5X06_POINT_BYTES)
+
+struct TouchPoint {
+    uint16_t x;
+    uint16_t y;
+    uint8_t id;
+};
+
+struct TouchSample {
+    uint32_t irq_us;            // Front de l'interruption (µs, 32 bits : écarts seulement)
+    uint8_t count;
+    TouchPoint points[FT5X06_MAX_POINTS];
+};
+
+// Décodage d'une rafale de FT5X06_BURST_BYTES octets lue depuis TD_STATUS
+bool ft5x06_parse(const uint8_t* regs, uint32_t irq_us, TouchSample& sample);
+
+// File sans verrou un producteur (tâche de lecture I2C) / un consommateur
+// (rappel LVGL). Pleine, elle écarte le plus ancien échantillon : le plus
+// récent, dont une levée du doigt, n'est jamais perdu. Le producteur avance
+// alors `tail` par CAS ; le consommateur ne valide sa copie que si son propre
+// CAS sur `tail` réussit, sinon la case a pu être réécrite et il relit.
+class TouchRing {
+public:
+    static constexpr uint8_t CAPACITY = 16;     // Puissance de 2
+
+private:
+    TouchSample samples[CAPACITY] = {};
+    std::atomic<uint32_t> head{0};              // Écrit par le producteur
+    std::atomic<uint32_t> tail{0};              // Consommateur, et producteur si pleine
+
+public:
+    // Retourne false si le plus ancien échantillon a été écarté pour faire place
+    bool push(const TouchSample& sample);
+    bool pop(TouchSample& sample);
+    bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+};
+
+enum class GestureType : uint8_t {
+    NONE = 0,
+    SWIPE_LEFT,
+    SWIPE_RIGHT,
+    SWIPE_UP,
+    SWIPE_DOWN,
+    PINCH                       // scale_permille : écart courant / écart au palier précédent
+};
+
+struct TouchGesture {
+    GestureType type;
+    uint16_t start_x;
+    uint16_t start_y;
+    uint16_t scale_permille;
+};
+
+// Reconnaissance de gestes sur la suite des échantillons : balayage à un doigt
+// (déplacement dominant, rapide) et pincement à deux doigts, émis par paliers
+// de PINCH_STEP pour mille.
+class GestureDetector {
+public:
+    static constexpr uint16_t SWIPE_MIN_PX = 120;
+    static constexpr uint32_t SWIPE_MAX_US = 600000;
+    static constexpr uint16_t PINCH_STEP = 150;
+
+private:
+    bool tracking = false;
+    bool multi = false;         // Deux doigts vus : pas de balayage à la levée
+    uint32_t start_us = 0;
+    TouchPoint start = {};
+    TouchPoint last = {};
+    float pinch_base = 0.0f;    // Écart entre les doigts au dernier palier émis
+
+public:
+    // Retourne true si `gesture` a été rempli
+    bool feed(const TouchSample& sample, TouchGesture& gesture);
+    void reset() { tracking = false; multi = false; }
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdint.h>
+
+// Liaison modèle -> widgets pilotée par les changements : chaque champ lié
+// garde la dernière valeur affichée (quantifiée) et le widget n'est touché,
+// donc invalidé par LVGL, que si cette valeur visible change.
+enum class BindingKind : uint8_t {
+    LABEL,      // Texte formaté (format printf avec un int32_t)
+    SLIDER,     // lv_slider_set_value
+    BAR,        // lv_bar_set_value
+    TEXT        // Texte statique choisi parmi des chaînes constantes
+};
+
+class UIBindings {
+public:
+    static constexpr uint8_t MAX_BINDINGS = 16;
+    static constexpr int8_t INVALID = -1;
+
+    struct Stats {
+        uint32_t widget_updates;    // Appels LVGL effectués
+        uint32_t skipped;           // Valeur visible inchangée : aucun appel
+    };
+
+private:
+    struct Binding {
+        lv_obj_t* widget;
+        BindingKind kind;
+        const char* format;         // LABEL : format, TEXT : texte affiché
+        float step;                 // Pas de quantification (unité affichée)
+        int32_t shown;              // Dernière valeur affichée, en pas
+        bool valid;                 // Faux : prochaine valeur appliquée d'office
+    };
+
+    Binding bindings[MAX_BINDINGS] = {};
+    uint8_t count = 0;
+    Stats stats = {};
+
+    int8_t add(lv_obj_t* widget, BindingKind kind, const char* format, float step);
+    void apply(Binding& binding);
+
+public:
+    // Fraction de pas à dépasser pour quitter la valeur affichée : évite le
+    // clignotement d'un capteur qui oscille autour d'un demi-pas.
+    static constexpr float HYSTERESIS = 0.1f;
+
+    int8_t bind_label(lv_obj_t* label, const char* format, float step = 1.0f);
+    int8_t bind_slider(lv_obj_t* slider, float step = 1.0f);
+    int8_t bind_bar(lv_obj_t* bar, float step = 1.0f);
+    int8_t bind_text(lv_obj_t* label);
+
+    // Retourne true si le widget a été mis à jour
+    bool set(int8_t id, float value);
+    bool set_text(int8_t id, const char* text);
+
+    // Le widget a pu être modifié hors liaison (geste utilisateur) :
+    // resynchronisation à la prochaine valeur
+    void invalidate(int8_t id);
+    void invalidate_all();
+    void clear();
+
+    // Valeur affichée en unités du modèle (0 si jamais affichée)
+    float displayed(int8_t id) const;
+    uint8_t size() const { return count; }
+    const Stats& get_stats() const { return stats; }
+};
@@ -3,26 +3,27 @@
 #include "lvgl.h"
 #include "reptile_types.h"
 #include "game_engine.h"
+#include "ui_binding.h"
+#include "ui_views.h"
+#include "notification_center.h"
+#include "screen_cache.h"
+#include "reptile_list_view.h"
+#include "card_layer_cache.h"
+#include "vitals_chart.h"
+#include "touch_input.h"
 
 class UIManager {
 private:
     GameEngine* game_engine;
     
     // Écrans principaux
-    lv_obj_t* main_screen;
-    lv_obj_t* reptile_selection_screen;
-    lv_obj_t* care_screen;
-    lv_obj_t* habitat_screen;
-    lv_obj_t* breeding_screen;
-    lv_obj_t* statistics_screen;
-    lv_obj_t* settings_screen;
+    lv_obj_t* main_screen;      // Construit au démarrage, les autres à la demande
     
     // Widgets principaux
     lv_obj_t* reptile_info_panel;
     lv_obj_t* health_bars;
     lv_obj_t* environment_controls;
     lv_obj_t* feeding_panel;
-    lv_obj_t* behavior_display;
     lv_obj_t* notification_area;
     
     // Styles personnalisés
@@ -33,13 +34,41 @@ private:
     lv_style_t style_health_good;
     lv_style_t style_health_warning;
     lv_style_t style_health_critical;
+
+    // Ombres des cartes pré-rendues (style_card)
+    CardLayerCache card_layers;
     
     // État de l'interface
     static constexpr uint8_t screen_count = 7;
     lv_obj_t* screens[screen_count];
     uint8_t current_screen;
-    bool notification_visible;
+    ScreenCache screen_cache;
+
+    // Liste virtualisée de SCREEN_REPTILE_SELECT (objets recréés avec l'écran)
+    ReptileListView reptile_list;
+
+    // Historique température / humidité du reptile sélectionné (SCREEN_STATS)
+    VitalsChart vitals_chart;
+
+    // Toasts préalloués, pilotés par un seul lv_timer
+    NotificationCenter notifications;
+    lv_obj_t* toasts[NotificationCenter::SLOT_COUNT];
+    lv_obj_t* toast_labels[NotificationCenter::SLOT_COUNT];
+    lv_timer_t* notification_timer;
     uint32_t last_ui_update;
+
+    // Poignées des widgets dynamiques de l'écran principal
+    MainScreenView main_view;
+
+    // Liaisons modèle -> widgets (mise à jour sur changement visible)
+    UIBindings bindings;
+    int8_t bind_temp_label;
+    int8_t bind_temp_slider;
+    int8_t bind_hum_label;
+    int8_t bind_hum_slider;
+    int8_t bind_health[MainScreenView::HEALTH_BAR_COUNT];
+    int8_t bind_behavior;
+    int8_t bind_last_feeding;
     
     // Méthodes de construction d'interface
     void create_main_screen();
@@ -48,6 +77,20 @@ private:
     void create_feeding_interface();
     void create_care_buttons();
     void create_navigation_menu();
+    void create_notification_toasts();
+
+    // Écrans secondaires, construits au premier affichage
+    lv_obj_t* create_screen_frame(const char* title);
+    lv_obj_t* add_screen_card(lv_obj_t* screen, const char* text);
+    lv_obj_t* create_reptile_select_screen();
+    lv_obj_t* create_care_screen();
+    lv_obj_t* create_habitat_screen();
+    lv_obj_t* create_breeding_screen();
+    lv_obj_t* create_stats_screen();
+    lv_obj_t* create_settings_screen();
+    bool build_screen(uint8_t index);
+    void evict_screen(uint8_t index);
+    void bind_main_view();
     
     // Callbacks d'événements
     static void on_feed_button(lv_event_t* e);
@@ -57,13 +100,21 @@ private:
     static void on_clean_terrarium(lv_event_t* e);
     static void on_health_check(lv_event_t* e);
     static void on_navigation_click(lv_event_t* e);
+    static void on_breeding_open(lv_event_t* e);
+    static void on_reptile_selected(void* context, uint16_t engine_index);
     
     // Utilitaires UI
     void update_health_display(const Reptile& reptile);
     void update_environment_display(const Reptile& reptile);
     void update_behavior_animation(const Reptile& reptile);
+    void update_vitals_display(const Reptile& reptile);
+    void show_selected_reptile();
     void show_notification(const char* message, bool is_warning = false);
+    void notify(uint32_t key, const char* message, NotificationPriority priority,
+                uint32_t cooldown_ms = 0);
     void hide_notification();
+    void sync_toasts();
+    static void on_notification_timer(lv_timer_t* timer);
     
     // Animations
     void animate_feeding(lv_obj_t* target);
@@ -75,13 +126,31 @@ public:
     bool initialize();
     void update();
 
-    // Gestion des écrans
+    // Gestion des écrans : construction au premier affichage, cache LRU
+    // borné par un budget mémoire (octets de tas consommés par les écrans)
+    static constexpr uint32_t DEFAULT_SCREEN_BUDGET = 96 * 1024;
     void switch_to_screen(uint8_t screen_id);
+    void set_screen_budget(uint32_t bytes);
+    const ScreenCache& get_screen_cache() const { return screen_cache; }
+
+    // Ombres de cartes en cache ; false = ombre LVGL (mesure de référence)
+    void set_card_layers(bool enabled) { card_layers.set_enabled(enabled); }
+    const CardLayerCache::Stats& get_card_layer_stats() const { return card_layers.get_stats(); }
+
+    // Gestes tactiles (DisplayDriver::set_gesture_callback) : balayage sur le
+    // panneau du reptile pour changer de reptile, pincement sur le graphique
+    void handle_gesture(const TouchGesture& gesture);
+    static void on_gesture(void* context, const TouchGesture& gesture);
 
     // Notifications système
     void show_feeding_reminder(const char* reptile_name);
     void show_health_alert(const char* reptile_name, const char* issue);
-    
+
+    // Statistiques de liaison : mises à jour de widgets effectives / évitées
+    const UIBindings::Stats& get_binding_stats() const { return bindings.get_stats(); }
+    const NotificationCenter::Stats& get_notification_stats() const { return notifications.get_stats(); }
+    // Liaisons, notifications, cache d'écrans et couches de cartes
+    void log_report() const;
 };
 
 // IDs des écrans
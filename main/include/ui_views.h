@@ -0,0 +1,44 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdint.h>
+
+// Vue typée de l'écran principal : les widgets mis à jour à chaque image sont
+// enregistrés une fois à la construction et gardés en poignées directes, sans
+// parcours de l'arbre LVGL (lv_obj_get_child) ni dépendance à l'ordre des enfants.
+// Les écrans secondaires n'ont pas encore de widget dynamique (hors liste des
+// reptiles et graphique, qui tiennent leurs propres poignées) : pas de vue typée.
+struct MainScreenView {
+    static constexpr uint8_t HEALTH_BAR_COUNT = 4;  // Santé, faim, hydratation, stress
+
+    lv_obj_t* name_label = nullptr;
+    lv_obj_t* vital_info = nullptr;
+    lv_obj_t* behavior_label = nullptr;
+    lv_obj_t* health_bars[HEALTH_BAR_COUNT] = {};
+    lv_obj_t* temp_label = nullptr;
+    lv_obj_t* temp_slider = nullptr;
+    lv_obj_t* hum_label = nullptr;
+    lv_obj_t* hum_slider = nullptr;
+    lv_obj_t* last_feeding_label = nullptr;
+
+    // Nom du premier widget non enregistré, nullptr si la vue est complète.
+    // Vérifié au démarrage : une construction incomplète échoue tout de suite.
+    const char* first_missing() const {
+        if (!name_label) return "name_label";
+        if (!vital_info) return "vital_info";
+        if (!behavior_label) return "behavior_label";
+        for (uint8_t i = 0; i < HEALTH_BAR_COUNT; i++) {
+            if (!health_bars[i]) return "health_bars";
+        }
+        if (!temp_label) return "temp_label";
+        if (!temp_slider) return "temp_slider";
+        if (!hum_label) return "hum_label";
+        if (!hum_slider) return "hum_slider";
+        if (!last_feeding_label) return "last_feeding_label";
+        return nullptr;
+    }
+};
+
+// Tout nouveau widget doit être ajouté à first_missing()
+static_assert(sizeof(MainScreenView) == 12 * sizeof(lv_obj_t*),
+              "MainScreenView modifiée : mettre à jour first_missing()");
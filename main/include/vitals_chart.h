@@ -0,0 +1,59 @@
+#pragma once
+
+#include "lvgl.h"
+#include "chart_series.h"
+
+// Graphique température / humidité de SCREEN_STATS. L'historique (ChartSeries)
+// est alimenté en continu, écran construit ou non ; le lv_chart en mode
+// circulaire reçoit une colonne min/max par case terminée, ce qui n'invalide
+// que les points voisins. Changement de zoom ou retour sur l'écran : un seul
+// rechargement depuis le palier, sans re-décimation.
+class VitalsChart {
+public:
+    static constexpr uint16_t COLUMNS = 464;            // Deux points (min, max) par colonne
+    static constexpr uint32_t SAMPLE_MS = 1000;
+    static constexpr uint16_t NO_SUBJECT = 0xFFFF;
+
+    struct Stats {
+        uint32_t samples;
+        uint32_t columns_appended;  // Ajouts incrémentaux
+        uint32_t reloads;           // Rechargements complets (zoom, ouverture)
+        uint32_t last_reload_us;
+    };
+
+private:
+    ChartSeries temperature;        // Dixièmes de °C
+    ChartSeries humidity;           // Dixièmes de %
+    lv_obj_t* chart = nullptr;
+    lv_obj_t* zoom_dropdown = nullptr;
+    lv_chart_series_t* temp_series = nullptr;
+    lv_chart_series_t* hum_series = nullptr;
+    uint8_t zoom = 0;               // Palier affiché
+    uint32_t shown = 0;             // Cases du palier déjà dans le lv_chart
+    uint16_t subject = NO_SUBJECT;
+    uint32_t last_sample_ms = 0;
+    Stats stats = {};
+
+    void reload();
+    void append_column(uint32_t sequence);
+    static void on_zoom_changed(lv_event_t* e);
+
+public:
+    bool init();
+
+    // Un échantillon par SAMPLE_MS ; un autre reptile repart d'un historique vide
+    void sample(uint16_t reptile_index, float temperature_c, float humidity_pct, uint32_t now_ms);
+
+    void create(lv_obj_t* parent, lv_coord_t x, lv_coord_t y);
+    // L'écran parent a été supprimé (éviction du cache d'écrans)
+    void detach();
+    // Appelé à chaque image quand l'écran est affiché
+    void update();
+    void set_zoom(uint8_t tier);
+    uint8_t get_zoom() const { return zoom; }
+    // Zone du graphique à l'écran (pincement), false si l'écran n'est pas construit
+    bool contains(int32_t x, int32_t y) const;
+
+    size_t memory_bytes() const { return temperature.memory_bytes() + humidity.memory_bytes(); }
+    const Stats& get_stats() const { return stats; }
+};
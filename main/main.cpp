@@ -13,6 +13,11 @@
 #include "include/game_engine.h"
 #include "include/ui_manager.h"
 #include "include/save_system.h"
+#include "include/render_governor.h"
+#include "feeding_system.h"
+#include "habitat_system.h"
+#include "health_system.h"
+#include "reproduction_system.h"
 
 static const char* TAG = "ReptileKeeper";
 
@@ -22,6 +27,11 @@ static GameEngine* game_engine = nullptr;
 static UIManager* ui_manager = nullptr;
 static SaveSystem* save_system = nullptr;
 
+// Cadence de la tâche UI : réveillée par le tactile et par le moteur de jeu
+static RenderGovernor render_governor;
+static TaskHandle_t ui_task_handle = nullptr;
+static std::atomic<bool> model_changed{false};
+
 // Tâches FreeRTOS
 static void game_update_task(void* pvParameters);
 static void ui_update_task(void* pvParameters);
@@ -56,6 +66,17 @@ extern "C" void app_main(void) {
         ESP_LOGE(TAG, "ERREUR CRITIQUE: Échec initialisation interface");
         abort();
     }
+    display_driver->set_gesture_callback(UIManager::on_gesture, ui_manager);
+    
+    if (!save_system->initialize()) {
+        ESP_LOGE(TAG, "Système de sauvegarde indisponible - progression non persistée");
+    }
+    
+    // Sections persistantes des composants : une seule image, un seul commit
+    save_system->register_section(&feeding_persistence());
+    save_system->register_section(&habitat_persistence());
+    save_system->register_section(&health_persistence());
+    save_system->register_section(&reproduction_persistence());
     
     // Chargement de la sauvegarde ou création d'un nouveau jeu
     if (!save_system->load_game_data()) {
@@ -85,7 +106,7 @@ extern "C" void app_main(void) {
         12288,          // Stack size plus important pour LVGL
         nullptr,
         1,              // Priority (normale pour UI)
-        nullptr,
+        &ui_task_handle,
         1               // Core 1
     );
     
@@ -154,6 +175,7 @@ static void game_update_task(void* pvParameters) {
     
     uint32_t last_timestamp = esp_timer_get_time() / 1000;
     uint32_t update_counter = 0;
+    uint32_t last_change_weight = game_engine->get_change_weight();
     
     ESP_LOGI(TAG, "Moteur de jeu démarré (10 Hz)");
     
@@ -163,11 +185,20 @@ static void game_update_task(void* pvParameters) {
         
         // Mise à jour du moteur de jeu
         game_engine->update(delta_time);
+        save_system->refresh_emergency_image();
+
+        // Action ou événement du modèle : l'interface n'attend pas son prochain relevé
+        uint32_t change_weight = game_engine->get_change_weight();
+        if (change_weight != last_change_weight) {
+            last_change_weight = change_weight;
+            model_changed.store(true, std::memory_order_relaxed);
+            if (ui_task_handle) xTaskNotifyGive(ui_task_handle);
+        }
+        
+        // Sauvegarde automatique : la politique arbitre changements et usure flash
+        save_system->auto_save();
         
-        // Sauvegarde automatique toutes les 10 secondes (100 cycles)
         if (++update_counter % 100 == 0) {
-            save_system->auto_save();
-            
             // Log des statistiques de performance
             ESP_LOGI(TAG, "Stats: RAM libre=%d bytes, Uptime=%d ms", 
                      esp_get_free_heap_size(), 
@@ -179,24 +210,98 @@ static void game_update_task(void* pvParameters) {
     }
 }
 
-// Tâche de mise à jour de l'interface - 30 Hz pour fluidité
+// Tâche de mise à jour de l'interface : 30 Hz au plus, endormie tant que
+// ni LVGL, ni le modèle, ni le tactile n'ont besoin d'elle
 static void ui_update_task(void* pvParameters) {
-    const TickType_t xFrequency = pdMS_TO_TICKS(33); // ~33ms = 30Hz
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+    RenderGovernor::Config config;
+    config.dim_after_ms = 60000;
+    config.off_after_ms = 300000;
+    config.model_period_ms = VitalsChart::SAMPLE_MS;   // Une mesure par seconde pour le graphique
+    config.input_period_ms = 33;
+    config.input_tail_ms = 1000;
+    config.dim_frame_ms = 100;
+    config.max_sleep_ms = 1000;
+    render_governor.configure(config, esp_timer_get_time() / 1000);
+    display_driver->set_input_task(xTaskGetCurrentTaskHandle());
     
-    ESP_LOGI(TAG, "Interface utilisateur démarrée (30 Hz)");
+    ESP_LOGI(TAG, "Interface utilisateur démarrée (30 Hz max, cadence adaptative)");
     
     while (true) {
-        // Mise à jour LVGL (gestion tactile, animations, rendu)
-        display_driver->update();
+        int64_t wake_us = esp_timer_get_time();
+        uint32_t now = wake_us / 1000;
+        bool input = display_driver->has_pending_input();
+        // Widgets, indev et gestes (UIManager::on_gesture) sous le verrou LVGL :
+        // la surveillance lit l'interface depuis le cœur 0
+        lv_lock();
+        if (input && render_governor.on_input(now)) {
+            // Réveil : le toucher rallume l'écran sans cliquer sous le doigt
+            display_driver->discard_touch_until_release();
+            display_driver->enable_screen();
+            display_driver->set_brightness(100);
+            lv_obj_invalidate(lv_screen_active());
+            ESP_LOGI(TAG, "Écran rallumé");
+        }
+        if (model_changed.exchange(false, std::memory_order_relaxed)) {
+            render_governor.on_model_change();
+        }
+        
+        if (render_governor.update_state(now)) {
+            RenderGovernor::PowerState state = render_governor.get_state();
+            ESP_LOGI(TAG, "Écran %s", RenderGovernor::state_name(state));
+            if (state == RenderGovernor::PowerState::OFF) {
+                display_driver->set_brightness(0);
+                display_driver->disable_screen();
+            }
+        }
         
-        // Mise à jour de l'interface de jeu
-        ui_manager->update();
+        // Le verrou du moteur garde les reptiles lus par peek_reptile() (le tick
+        // peut passer de la projection à la copie en RAM, la sauvegarde libérer
+        // la projection) ; il n'est tenu que pendant ces lectures, jamais pendant
+        // le rendu ni les attentes de copie et de VSYNC
+        game_engine->storage_mutex().lock();
+        // Lecture tactile : échantillons publiés, puis cadence fixe pour l'inertie
+        if (input || render_governor.input_active(now)) {
+            display_driver->read_input();
+        }
         
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+        // Mise à jour de l'interface de jeu : relevé périodique ou changement signalé
+        if (render_governor.model_due(now)) {
+            ui_manager->update();
+            render_governor.model_done(now);
+        }
+        game_engine->storage_mutex().unlock();
+        
+        // Mise à jour LVGL (animations, rendu) ; écran éteint, rien n'est rendu
+        uint32_t lvgl_next = LV_NO_TIMER_READY;
+        if (render_governor.lvgl_due(now)) {
+            lvgl_next = display_driver->update();
+            render_governor.lvgl_done(now);
+        }
+        lv_unlock();
+        
+        int64_t done_us = esp_timer_get_time();
+        render_governor.record_wakeup(input, (uint32_t)(done_us - wake_us));
+        uint32_t sleep_ms = render_governor.next_sleep_ms(done_us / 1000, lvgl_next);
+        if (sleep_ms) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
+        else taskYIELD();
     }
 }
 
+// Charge d'un cœur depuis le relevé précédent : part du temps hors de sa
+// tâche idle (statistiques d'exécution FreeRTOS, horloge esp_timer en us)
+static float core_load_percent(BaseType_t core) {
+    static uint32_t last_idle[portNUM_PROCESSORS] = {};
+    static int64_t last_us[portNUM_PROCESSORS] = {};
+    uint32_t idle = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(core));
+    int64_t now_us = esp_timer_get_time();
+    uint32_t idle_us = idle - last_idle[core];
+    int64_t elapsed_us = now_us - last_us[core];
+    last_idle[core] = idle;
+    last_us[core] = now_us;
+    if (elapsed_us <= 0 || idle_us >= elapsed_us) return 0.0f;
+    return 100.0f * (float)(elapsed_us - idle_us) / (float)elapsed_us;
+}
+
 // Tâche de surveillance système - 1 Hz
 static void system_monitoring_task(void* pvParameters) {
     const TickType_t xFrequency = pdMS_TO_TICKS(1000); // 1000ms = 1Hz
@@ -205,6 +310,7 @@ static void system_monitoring_task(void* pvParameters) {
     uint32_t boot_timestamp = esp_timer_get_time() / 1000;
     
     ESP_LOGI(TAG, "Surveillance système démarrée (1 Hz)");
+    core_load_percent(1);
     
     while (true) {
         uint32_t current_time = esp_timer_get_time() / 1000;
@@ -220,6 +326,60 @@ static void system_monitoring_task(void* pvParameters) {
             ESP_LOGI(TAG, "Uptime: %d secondes", uptime_seconds);
             ESP_LOGI(TAG, "RAM libre: %d bytes (min: %d)", free_heap, min_free_heap);
             ESP_LOGI(TAG, "Reptiles actifs: %zu", game_engine->get_reptile_count());
+            save_system->log_io_report();
+            DisplayDriver::RenderStats render = display_driver->take_render_stats();
+            ESP_LOGI(TAG, "Rendu (%s): %u zones/s, %u octets copiés/s, %u échanges/s",
+                     display_driver->get_render_mode() == RenderMode::DIRECT ? "direct" : "partiel",
+                     (unsigned)(render.flushes / 60), (unsigned)(render.bytes / 60), (unsigned)(render.swaps / 60));
+            // Bande passante PSRAM estimée : balayage, puis en partiel copie vers le
+            // framebuffer ; en direct, écriture des zones rendues et recopie
+            // (lecture + écriture) des zones de l'image précédente dans l'autre tampon
+            uint64_t scan_bytes = (uint64_t)render.frames * LCD_WIDTH * LCD_HEIGHT * (LCD_BIT_PER_PIXEL / 8);
+            uint64_t rendered_bytes = (uint64_t)render.planned_px * (LCD_BIT_PER_PIXEL / 8);
+            uint64_t psram_bytes = scan_bytes + (display_driver->get_render_mode() == RenderMode::DIRECT
+                                                     ? 3ull * rendered_bytes
+                                                     : 2ull * render.bytes);
+            ESP_LOGI(TAG, "Affichage (profil %s): %.1f images/s balayées (%.1f théoriques), %u rendus/s, PSRAM ~%.1f Mo/s",
+                     DisplayDriver::get_timing_profile(display_driver->get_lcd_profile()).name,
+                     render.frames / 60.0f, DisplayDriver::get_refresh_hz(display_driver->get_lcd_profile()),
+                     (unsigned)(render.refreshes / 60), psram_bytes / 60.0 / 1e6);
+            if (render.planned_frames) {
+                uint32_t wasted = render.planned_px > render.requested_px ? render.planned_px - render.requested_px : 0;
+                ESP_LOGI(TAG, "Planification: %u -> %u zones/image, %u px/image rendus, %u px/image superflus",
+                         (unsigned)(render.areas_in / render.planned_frames),
+                         (unsigned)(render.areas_out / render.planned_frames),
+                         (unsigned)(render.planned_px / render.planned_frames),
+                         (unsigned)(wasted / render.planned_frames));
+            }
+            if (display_driver->get_render_mode() == RenderMode::DIRECT && render.swaps) {
+                ESP_LOGI(TAG, "Échange au VSYNC: %u us/image attendus, %u délais dépassés",
+                         (unsigned)(render.wait_us / render.swaps), (unsigned)render.vsync_timeouts);
+            }
+            if (render.refreshes && render.copy_us) {
+                // Recouvrement : part des copies effectuée pendant le rendu de la zone suivante
+                uint32_t overlap_us = render.copy_us > render.wait_us ? render.copy_us - render.wait_us : 0;
+                ESP_LOGI(TAG, "Copie asynchrone: %u us/image copiés, %u us/image attendus, %u us/image recouverts",
+                         (unsigned)(render.copy_us / render.refreshes), (unsigned)(render.wait_us / render.refreshes),
+                         (unsigned)(overlap_us / render.refreshes));
+            }
+            ESP_LOGI(TAG, "Rendu LVGL (%d unités de dessin): %u rafraîchissements, %u zones invalidées, %u us par image, %u us par zone invalidée",
+                     (int)LV_DRAW_SW_DRAW_UNIT_CNT, (unsigned)render.refreshes, (unsigned)render.invalidated,
+                     (unsigned)(render.refreshes ? render.render_us / render.refreshes : 0),
+                     (unsigned)(render.invalidated ? render.render_us / render.invalidated : 0));
+            DisplayDriver::TouchStats touch = display_driver->take_touch_stats();
+            ESP_LOGI(TAG, "Tactile: %u interruptions, %u lectures, %u erreurs I2C, %u gestes, latence entrée->flush %u us (max %u us)",
+                     (unsigned)touch.irqs, (unsigned)touch.reads, (unsigned)touch.errors, (unsigned)touch.gestures,
+                     (unsigned)(touch.latency_count ? touch.latency_sum_us / touch.latency_count : 0),
+                     (unsigned)touch.latency_max_us);
+            display_driver->get_i2c_bus().log_report();
+            RenderGovernor::Stats pacing = render_governor.take_stats();
+            ESP_LOGI(TAG, "Cadence UI (écran %s): %.1f réveils/s (%u tactiles), %.1f passes LVGL/s, charge cœur 1 %.1f %%, tâche UI éveillée %.1f %%, %u changements d'état",
+                     RenderGovernor::state_name(render_governor.get_state()),
+                     pacing.wakeups / 60.0f, (unsigned)pacing.input_wakeups, pacing.lvgl_runs / 60.0f,
+                     core_load_percent(1), pacing.awake_us / 600000.0f, (unsigned)pacing.transitions);
+            lv_lock();
+            ui_manager->log_report();
+            lv_unlock();
             ESP_LOGI(TAG, "Température CPU: ~%d°C", (esp_random() % 20) + 45); // Estimation
             ESP_LOGI(TAG, "=====================");
         }
@@ -0,0 +1,204 @@
+#include "include/notification_center.h"
+#include <cstring>
+
+// Comparaisons d'échéances tolérantes au rebouclage du compteur en ms
+static inline bool time_reached(uint32_t now_ms, uint32_t deadline_ms) {
+    return (int32_t)(now_ms - deadline_ms) >= 0;
+}
+
+uint32_t NotificationCenter::make_key(const char* category, const char* subject) {
+    uint32_t hash = 2166136261u;
+    for (const char* p = category; p && *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    hash = (hash ^ 0x1F) * 16777619u; // Séparateur : ("ab", "c") != ("a", "bc")
+    for (const char* p = subject; p && *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    return hash;
+}
+
+bool NotificationCenter::in_cooldown(uint32_t key, uint32_t now_ms) const {
+    for (uint8_t i = 0; i < cooldown_count; i++) {
+        if (cooldowns[i].key == key) return !time_reached(now_ms, cooldowns[i].until_ms);
+    }
+    return false;
+}
+
+void NotificationCenter::start_cooldown(uint32_t key, uint32_t until_ms, uint32_t now_ms) {
+    CooldownEntry* target = nullptr;
+    for (uint8_t i = 0; i < cooldown_count && !target; i++) {
+        if (cooldowns[i].key == key) target = &cooldowns[i];
+    }
+    if (!target && cooldown_count < COOLDOWN_KEYS) {
+        target = &cooldowns[cooldown_count++];
+    }
+    if (!target) {
+        // Table pleine : on recycle une entrée échue, sinon la plus proche de l'échéance
+        target = &cooldowns[0];
+        for (uint8_t i = 0; i < cooldown_count; i++) {
+            if (time_reached(now_ms, cooldowns[i].until_ms)) {
+                target = &cooldowns[i];
+                break;
+            }
+            if ((int32_t)(cooldowns[i].until_ms - target->until_ms) < 0) target = &cooldowns[i];
+        }
+    }
+    target->key = key;
+    target->until_ms = until_ms;
+}
+
+int8_t NotificationCenter::best_queued() const {
+    int8_t best = -1;
+    for (uint8_t i = 0; i < queued; i++) {
+        if (best < 0 || queue[i].priority > queue[best].priority ||
+            (queue[i].priority == queue[best].priority &&
+             (int32_t)(queue[i].sequence - queue[best].sequence) < 0)) {
+            best = (int8_t)i;
+        }
+    }
+    return best;
+}
+
+NotificationCenter::PostResult NotificationCenter::post(uint32_t key, const char* text,
+                                                        NotificationPriority priority, uint32_t now_ms,
+                                                        uint32_t duration_ms, uint32_t cooldown_ms) {
+    if (!text) return DROPPED;
+
+    // Déduplication : un texte différent remplace l'ancien (ex. valeur du curseur)
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        Slot& s = slots[i];
+        if (!s.active || s.notification.key != key) continue;
+        if (strncmp(s.notification.text, text, TEXT_SIZE - 1) != 0) {
+            strncpy(s.notification.text, text, TEXT_SIZE - 1);
+            s.notification.text[TEXT_SIZE - 1] = '\0';
+            s.expires_ms = now_ms + s.notification.duration_ms;
+            s.changed = true;
+        }
+        stats.duplicates++;
+        return DUPLICATE;
+    }
+    for (uint8_t i = 0; i < queued; i++) {
+        if (queue[i].key != key) continue;
+        strncpy(queue[i].text, text, TEXT_SIZE - 1);
+        queue[i].text[TEXT_SIZE - 1] = '\0';
+        if (priority > queue[i].priority) queue[i].priority = priority;
+        stats.duplicates++;
+        return DUPLICATE;
+    }
+
+    if (in_cooldown(key, now_ms)) {
+        stats.cooldown_suppressed++;
+        return COOLDOWN;
+    }
+
+    Notification* entry = nullptr;
+    if (queued < QUEUE_SIZE) {
+        entry = &queue[queued++];
+    } else {
+        // File pleine : évince le message le moins prioritaire s'il l'est moins que le nouveau
+        uint8_t lowest = 0;
+        for (uint8_t i = 1; i < queued; i++) {
+            if (queue[i].priority < queue[lowest].priority ||
+                (queue[i].priority == queue[lowest].priority &&
+                 (int32_t)(queue[i].sequence - queue[lowest].sequence) < 0)) {
+                lowest = i;
+            }
+        }
+        stats.dropped++;
+        if (queue[lowest].priority >= priority) return DROPPED;
+        entry = &queue[lowest];
+    }
+
+    entry->key = key;
+    entry->sequence = next_sequence++;
+    entry->duration_ms = duration_ms;
+    entry->cooldown_ms = cooldown_ms;
+    entry->priority = priority;
+    strncpy(entry->text, text, TEXT_SIZE - 1);
+    entry->text[TEXT_SIZE - 1] = '\0';
+    stats.posted++;
+    return POSTED;
+}
+
+void NotificationCenter::show(Slot& slot, uint8_t queue_index, uint32_t now_ms) {
+    slot.notification = queue[queue_index];
+    slot.expires_ms = now_ms + slot.notification.duration_ms;
+    slot.active = true;
+    slot.changed = true;
+    queue[queue_index] = queue[--queued];
+
+    if (slot.notification.cooldown_ms) {
+        // Le délai court à partir de la disparition du toast
+        start_cooldown(slot.notification.key,
+                       slot.expires_ms + slot.notification.cooldown_ms, now_ms);
+    }
+    stats.shown++;
+}
+
+bool NotificationCenter::tick(uint32_t now_ms) {
+    bool changed = false;
+
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (slots[i].active && time_reached(now_ms, slots[i].expires_ms)) {
+            slots[i].active = false;
+            slots[i].changed = true;
+            changed = true;
+        }
+    }
+
+    while (queued) {
+        int8_t best = best_queued();
+        Slot* target = nullptr;
+        for (uint8_t i = 0; i < SLOT_COUNT && !target; i++) {
+            if (!slots[i].active) target = &slots[i];
+        }
+        if (!target) {
+            // Tous les emplacements occupés : préemption du toast le moins prioritaire
+            Slot* lowest = &slots[0];
+            for (uint8_t i = 1; i < SLOT_COUNT; i++) {
+                if (slots[i].notification.priority < lowest->notification.priority) lowest = &slots[i];
+            }
+            if (queue[best].priority <= lowest->notification.priority) break;
+            stats.preempted++;
+            target = lowest;
+        }
+        show(*target, (uint8_t)best, now_ms);
+        changed = true;
+    }
+    return changed;
+}
+
+void NotificationCenter::dismiss_all() {
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (slots[i].active) {
+            slots[i].active = false;
+            slots[i].changed = true;
+        }
+    }
+}
+
+uint8_t NotificationCenter::visible_count() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (slots[i].active) count++;
+    }
+    return count;
+}
+
+bool NotificationCenter::slot_changed() const {
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (slots[i].changed) return true;
+    }
+    return false;
+}
+
+uint32_t NotificationCenter::next_deadline(uint32_t now_ms) const {
+    uint32_t deadline = UINT32_MAX;
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (!slots[i].active) continue;
+        uint32_t remaining = time_reached(now_ms, slots[i].expires_ms) ? 0 : slots[i].expires_ms - now_ms;
+        if (remaining < deadline) deadline = remaining;
+    }
+    return deadline;
+}
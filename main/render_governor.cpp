@@ -0,0 +1,113 @@
+#include "include/render_governor.h"
+
+void RenderGovernor::configure(const Config& governor_config, uint32_t now_ms) {
+    config = governor_config;
+    if (config.off_after_ms < config.dim_after_ms) config.off_after_ms = config.dim_after_ms;
+    if (config.max_sleep_ms == 0) config.max_sleep_ms = 1;
+    state = PowerState::ACTIVE;
+    last_input_ms = now_ms;
+    last_model_ms = now_ms;
+    last_lvgl_ms = now_ms;
+    model_dirty = true;
+}
+
+bool RenderGovernor::on_input(uint32_t now_ms) {
+    bool was_off = state == PowerState::OFF;
+    last_input_ms = now_ms;
+    // Changement d'écran ou action : les vues relisent le modèle sans attendre
+    model_dirty = true;
+    if (state != PowerState::ACTIVE) {
+        state = PowerState::ACTIVE;
+        transitions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return was_off;
+}
+
+bool RenderGovernor::update_state(uint32_t now_ms) {
+    uint32_t idle = elapsed(now_ms, last_input_ms);
+    PowerState target = idle >= config.off_after_ms ? PowerState::OFF
+                      : idle >= config.dim_after_ms ? PowerState::DIM
+                                                    : PowerState::ACTIVE;
+    // Sans entrée, l'état ne fait que descendre
+    if (target <= state) return false;
+    state = target;
+    transitions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool RenderGovernor::input_active(uint32_t now_ms) const {
+    return state != PowerState::OFF && elapsed(now_ms, last_input_ms) < config.input_tail_ms;
+}
+
+bool RenderGovernor::model_due(uint32_t now_ms) const {
+    return model_dirty || elapsed(now_ms, last_model_ms) >= config.model_period_ms;
+}
+
+void RenderGovernor::model_done(uint32_t now_ms) {
+    model_dirty = false;
+    last_model_ms = now_ms;
+}
+
+bool RenderGovernor::lvgl_due(uint32_t now_ms) const {
+    if (state == PowerState::OFF) return false;
+    if (state == PowerState::DIM) return elapsed(now_ms, last_lvgl_ms) >= config.dim_frame_ms;
+    return true;
+}
+
+void RenderGovernor::lvgl_done(uint32_t now_ms) {
+    last_lvgl_ms = now_ms;
+    lvgl_runs.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t RenderGovernor::next_sleep_ms(uint32_t now_ms, uint32_t lvgl_next_ms) const {
+    uint32_t sleep = config.max_sleep_ms;
+    auto until = [&](uint32_t since_ms, uint32_t period_ms) {
+        uint32_t spent = elapsed(now_ms, since_ms);
+        uint32_t remaining = spent >= period_ms ? 0 : period_ms - spent;
+        if (remaining < sleep) sleep = remaining;
+    };
+
+    if (state != PowerState::OFF) {
+        uint32_t lvgl_ms = lvgl_next_ms;
+        if (state == PowerState::DIM) {
+            uint32_t spent = elapsed(now_ms, last_lvgl_ms);
+            uint32_t floor_ms = spent >= config.dim_frame_ms ? 0 : config.dim_frame_ms - spent;
+            if (lvgl_ms < floor_ms) lvgl_ms = floor_ms;
+        }
+        if (lvgl_ms < sleep) sleep = lvgl_ms;
+    }
+
+    if (model_dirty) sleep = 0;
+    else until(last_model_ms, config.model_period_ms);
+
+    if (input_active(now_ms) && config.input_period_ms < sleep) sleep = config.input_period_ms;
+
+    if (state == PowerState::ACTIVE) until(last_input_ms, config.dim_after_ms);
+    else if (state == PowerState::DIM) until(last_input_ms, config.off_after_ms);
+    return sleep;
+}
+
+void RenderGovernor::record_wakeup(bool input, uint32_t awake_us) {
+    wakeups.fetch_add(1, std::memory_order_relaxed);
+    if (input) input_wakeups.fetch_add(1, std::memory_order_relaxed);
+    this->awake_us.fetch_add(awake_us, std::memory_order_relaxed);
+}
+
+RenderGovernor::Stats RenderGovernor::take_stats() {
+    Stats stats;
+    stats.wakeups = wakeups.exchange(0, std::memory_order_relaxed);
+    stats.input_wakeups = input_wakeups.exchange(0, std::memory_order_relaxed);
+    stats.lvgl_runs = lvgl_runs.exchange(0, std::memory_order_relaxed);
+    stats.awake_us = awake_us.exchange(0, std::memory_order_relaxed);
+    stats.transitions = transitions.exchange(0, std::memory_order_relaxed);
+    return stats;
+}
+
+const char* RenderGovernor::state_name(PowerState power_state) {
+    switch (power_state) {
+        case PowerState::ACTIVE: return "actif";
+        case PowerState::DIM: return "atténué";
+        case PowerState::OFF: return "éteint";
+    }
+    return "?";
+}
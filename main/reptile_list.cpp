@@ -0,0 +1,171 @@
+#include "include/reptile_list.h"
+#include <algorithm>
+#include <cstring>
+
+uint8_t reptile_urgency(const Reptile& reptile) {
+    const HealthStats& h = reptile.health;
+    uint32_t score = h.hunger_level + (100 - h.hydration) + h.stress_level + 2 * (100 - h.overall_health);
+    return (uint8_t)(score / 5);
+}
+
+void ReptileListModel::set_sort(ReptileSort value) {
+    if (value != sort) stale = true;
+    sort = value;
+}
+
+void ReptileListModel::set_filter(ReptileFilter value) {
+    if (value != filter) stale = true;
+    filter = value;
+}
+
+void ReptileListModel::set_species(int16_t value) {
+    if (value != species) stale = true;
+    species = value;
+}
+
+bool ReptileListModel::depends_on_live_values() const {
+    return sort == ReptileSort::HEALTH || sort == ReptileSort::URGENCY || filter != ReptileFilter::ALL;
+}
+
+ReptileListModel::RowKey ReptileListModel::make_key(const Reptile& reptile) {
+    return {(uint8_t)reptile.species, reptile.health.overall_health, reptile_urgency(reptile)};
+}
+
+bool ReptileListModel::accepts(const RowKey& key) const {
+    if (species != ALL_SPECIES && (int16_t)key.species != species) return false;
+    switch (filter) {
+        case ReptileFilter::CRITICAL: return key.health < 30;
+        case ReptileFilter::WARNING:  return key.health < 60;
+        case ReptileFilter::URGENT:   return key.urgency >= URGENT_THRESHOLD;
+        case ReptileFilter::ALL:      break;
+    }
+    return true;
+}
+
+// Égalités départagées par l'indice moteur : ordre stable d'une reconstruction à l'autre
+bool ReptileListModel::before(uint16_t a, uint16_t b, const GameEngine& engine) const {
+    const RowKey& ka = keys[a];
+    const RowKey& kb = keys[b];
+    int cmp = 0;
+    switch (sort) {
+        case ReptileSort::NAME:
+            cmp = strncmp(engine.peek_reptile(a)->name, engine.peek_reptile(b)->name, sizeof(Reptile::name));
+            break;
+        case ReptileSort::SPECIES:
+            cmp = (int)ka.species - (int)kb.species;
+            break;
+        case ReptileSort::HEALTH:
+            cmp = (int)ka.health - (int)kb.health;
+            break;
+        case ReptileSort::URGENCY:
+            cmp = (int)kb.urgency - (int)ka.urgency;
+            break;
+    }
+    return cmp != 0 ? cmp < 0 : a < b;
+}
+
+bool ReptileListModel::rebuild(const GameEngine& engine, size_t count) {
+    stale = false;
+    source_count = count;
+    scan_cursor = 0;
+
+    keys.resize(count);
+    next_order.clear();
+    next_order.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = make_key(*engine.peek_reptile((uint16_t)i));
+        if (accepts(keys[i])) next_order.push_back((uint16_t)i);
+    }
+    std::sort(next_order.begin(), next_order.end(),
+              [&](uint16_t a, uint16_t b) { return before(a, b, engine); });
+
+    // Ordre identique : les lignes n'ont pas à être reliées
+    if (next_order == order) return false;
+    order.swap(next_order);
+    return true;
+}
+
+bool ReptileListModel::reposition(uint16_t index, const GameEngine& engine) {
+    auto it = std::find(order.begin(), order.end(), index);
+    bool present = it != order.end();
+    size_t old_row = present ? (size_t)(it - order.begin()) : 0;
+    if (present) order.erase(it);
+    if (!accepts(keys[index])) return present;
+
+    // Le reste de l'ordre est trié sur les clés en cache : recherche dichotomique
+    auto pos = std::lower_bound(order.begin(), order.end(), index,
+                                [&](uint16_t a, uint16_t b) { return before(a, b, engine); });
+    bool moved = !present || (size_t)(pos - order.begin()) != old_row;
+    order.insert(pos, index);
+    return moved;
+}
+
+bool ReptileListModel::refresh(const GameEngine& engine) {
+    size_t count = engine.get_reptile_count();
+    if (count > GameEngine::MAX_REPTILES) count = GameEngine::MAX_REPTILES;
+    if (stale || count != source_count) return rebuild(engine, count);
+    if (!depends_on_live_values() || count == 0) return false;
+
+    // Relevé périodique : tranche suivante des clés vivantes, seules les
+    // lignes dont la clé a changé sont déplacées
+    bool changed = false;
+    size_t scan = std::min(count, LIVE_SCAN_PER_REFRESH);
+    for (size_t n = 0; n < scan; n++) {
+        uint16_t index = (uint16_t)scan_cursor;
+        scan_cursor = (scan_cursor + 1) % count;
+        RowKey key = make_key(*engine.peek_reptile(index));
+        RowKey& cached = keys[index];
+        if (key.health == cached.health && key.urgency == cached.urgency && key.species == cached.species) continue;
+        cached = key;
+        if (reposition(index, engine)) changed = true;
+    }
+    return changed;
+}
+
+VirtualWindow::VirtualWindow() {
+    for (uint8_t i = 0; i < MAX_POOL; i++) {
+        slot_items[i] = NO_ITEM;
+        dirty[i] = false;
+    }
+}
+
+void VirtualWindow::configure(uint16_t row_px, uint16_t viewport_px, uint8_t overscan_rows) {
+    row_height = row_px ? row_px : 1;
+    overscan = overscan_rows;
+    uint32_t visible = (viewport_px + row_height - 1) / row_height + 1; // +1 : ligne partielle
+    uint32_t wanted = visible + 2u * overscan;
+    pool = (uint8_t)(wanted > MAX_POOL ? MAX_POOL : wanted);
+    invalidate();
+}
+
+void VirtualWindow::invalidate() {
+    for (uint8_t i = 0; i < MAX_POOL; i++) {
+        slot_items[i] = NO_ITEM;
+        dirty[i] = true;
+    }
+}
+
+uint8_t VirtualWindow::update(int32_t scroll_y, size_t item_count) {
+    if (pool == 0) return 0;
+    size_t top = scroll_y > 0 ? (size_t)scroll_y / row_height : 0;
+    first_item = top > overscan ? top - overscan : 0;
+    if (item_count > pool && first_item > item_count - pool) first_item = item_count - pool;
+    if (item_count <= pool) first_item = 0;
+    end_item = std::min(item_count, first_item + pool);
+
+    uint8_t changed = 0;
+    for (uint8_t slot = 0; slot < pool; slot++) {
+        // Seul élément de [first, first + pool) congru à `slot` modulo pool
+        size_t item = first_item + (slot + pool - first_item % pool) % pool;
+        int32_t wanted = item < end_item ? (int32_t)item : NO_ITEM;
+        if (slot_items[slot] != wanted) {
+            slot_items[slot] = wanted;
+            dirty[slot] = true;
+        }
+        if (dirty[slot]) {
+            changed++;
+            rebinds++;
+        }
+    }
+    return changed;
+}
@@ -0,0 +1,221 @@
+#include "include/reptile_list_view.h"
+#include "include/species_database.h"
+#include "esp_timer.h"
+#include <cstdio>
+#include <cstring>
+
+ReptileListView::ReptileListView(GameEngine* game_engine, SelectCallback callback, void* context)
+    : engine(game_engine), on_select(callback), select_context(context),
+      container(nullptr), spacer(nullptr), count_label(nullptr), last_refresh_ms(0), stats() {
+    memset(rows, 0, sizeof(rows));
+}
+
+void ReptileListView::create(lv_obj_t* parent, lv_coord_t x, lv_coord_t y, lv_coord_t width, lv_coord_t height) {
+    // Contrôles de tri et de filtrage
+    lv_obj_t* sort_dd = lv_dropdown_create(parent);
+    lv_dropdown_set_options(sort_dd, "Tri: nom\nTri: espèce\nTri: santé\nTri: urgence");
+    lv_dropdown_set_selected(sort_dd, (uint32_t)model.get_sort());
+    lv_obj_set_size(sort_dd, 200, 44);
+    lv_obj_set_pos(sort_dd, x, y);
+    lv_obj_add_event_cb(sort_dd, on_sort_changed, LV_EVENT_VALUE_CHANGED, this);
+
+    lv_obj_t* filter_dd = lv_dropdown_create(parent);
+    lv_dropdown_set_options(filter_dd, "Tous\nSanté critique\nÀ surveiller\nUrgents");
+    lv_dropdown_set_selected(filter_dd, (uint32_t)model.get_filter());
+    lv_obj_set_size(filter_dd, 200, 44);
+    lv_obj_set_pos(filter_dd, x + 220, y);
+    lv_obj_add_event_cb(filter_dd, on_filter_changed, LV_EVENT_VALUE_CHANGED, this);
+
+    char species_options[512];
+    int used = snprintf(species_options, sizeof(species_options), "Toutes espèces");
+    for (uint8_t s = 0; s < REPTILE_SPECIES_COUNT && used < (int)sizeof(species_options); s++) {
+        used += snprintf(species_options + used, sizeof(species_options) - used, "\n%s",
+                         get_species_data((ReptileSpecies)s).common_name_fr);
+    }
+    lv_obj_t* species_dd = lv_dropdown_create(parent);
+    lv_dropdown_set_options(species_dd, species_options);
+    // Écran reconstruit après éviction : le filtre d'espèce du modèle est conservé
+    lv_dropdown_set_selected(species_dd, (uint32_t)(model.get_species() + 1));
+    lv_obj_set_size(species_dd, 280, 44);
+    lv_obj_set_pos(species_dd, x + 440, y);
+    lv_obj_add_event_cb(species_dd, on_species_changed, LV_EVENT_VALUE_CHANGED, this);
+
+    count_label = lv_label_create(parent);
+    lv_obj_set_style_text_color(count_label, lv_color_hex(0xD8DEE9), 0);
+    lv_obj_set_pos(count_label, x + 740, y + 12);
+
+    // Conteneur défilant : l'espaceur fixe la hauteur de contenu
+    lv_coord_t list_y = y + 56;
+    lv_coord_t list_height = height - 56;
+    container = lv_obj_create(parent);
+    lv_obj_set_size(container, width, list_height);
+    lv_obj_set_pos(container, x, list_y);
+    lv_obj_set_style_pad_all(container, 0, 0);
+    lv_obj_set_style_bg_color(container, lv_color_hex(0x3B4252), 0);
+    lv_obj_set_style_border_width(container, 0, 0);
+    lv_obj_set_scroll_dir(container, LV_DIR_VER);
+    lv_obj_add_event_cb(container, on_scroll, LV_EVENT_SCROLL, this);
+
+    spacer = lv_obj_create(container);
+    lv_obj_remove_style_all(spacer);
+    lv_obj_set_size(spacer, 1, 0);
+    lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE);
+
+    window.configure(ROW_HEIGHT, list_height, OVERSCAN);
+    for (uint8_t slot = 0; slot < window.pool_size(); slot++) {
+        Row& row = rows[slot];
+        row.obj = lv_obj_create(container);
+        lv_obj_set_size(row.obj, width - 24, ROW_HEIGHT - 6);
+        lv_obj_set_style_bg_color(row.obj, lv_color_hex(0x434C5E), 0);
+        lv_obj_set_style_radius(row.obj, 8, 0);
+        lv_obj_set_style_border_width(row.obj, 0, 0);
+        lv_obj_set_style_border_side(row.obj, LV_BORDER_SIDE_LEFT, 0);
+        lv_obj_clear_flag(row.obj, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_user_data(row.obj, (void*)(intptr_t)slot);
+        lv_obj_add_event_cb(row.obj, on_row_click, LV_EVENT_CLICKED, this);
+
+        row.name_label = lv_label_create(row.obj);
+        lv_label_set_text(row.name_label, "");
+        lv_obj_set_style_text_color(row.name_label, lv_color_hex(0xECEFF4), 0);
+        lv_obj_align(row.name_label, LV_ALIGN_LEFT_MID, 0, 0);
+
+        row.detail_label = lv_label_create(row.obj);
+        lv_label_set_text(row.detail_label, "");
+        lv_obj_set_style_text_color(row.detail_label, lv_color_hex(0xD8DEE9), 0);
+        lv_obj_align(row.detail_label, LV_ALIGN_LEFT_MID, 300, 0);
+        row.urgency_level = 0;
+    }
+
+    // Ordre recalculé à l'ouverture : la population a pu changer pendant l'éviction
+    model.mark_stale();
+    refresh_order();
+}
+
+void ReptileListView::detach() {
+    // Objets supprimés avec l'écran parent : seules les poignées sont oubliées
+    container = nullptr;
+    spacer = nullptr;
+    count_label = nullptr;
+    memset(rows, 0, sizeof(rows));
+}
+
+bool ReptileListView::refresh_order() {
+    int64_t start = esp_timer_get_time();
+    if (!model.refresh(*engine)) return false;
+    stats.rebuilds++;
+    stats.last_rebuild_us = (uint32_t)(esp_timer_get_time() - start);
+
+    if (!container) return true;
+    lv_obj_set_height(spacer, window.content_height(model.size()));
+    char text[48];
+    snprintf(text, sizeof(text), "%zu / %zu reptiles", model.size(), engine->get_reptile_count());
+    lv_label_set_text(count_label, text);
+
+    window.invalidate();
+    sync_window(true);
+    return true;
+}
+
+void ReptileListView::sync_window(bool force) {
+    if (!container) return;
+    window.update(lv_obj_get_scroll_y(container), model.size());
+    for (uint8_t slot = 0; slot < window.pool_size(); slot++) {
+        if (force || window.is_dirty(slot)) {
+            bind_row(slot, window.is_dirty(slot));
+            window.clear_dirty(slot);
+        }
+    }
+}
+
+void ReptileListView::bind_row(uint8_t slot, bool moved) {
+    Row& row = rows[slot];
+    int32_t item = window.slot_item(slot);
+    const Reptile* reptile = item == VirtualWindow::NO_ITEM ? nullptr
+                                                            : engine->peek_reptile(model.engine_index(item));
+    if (!reptile) {
+        lv_obj_add_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    if (moved) {
+        lv_obj_set_pos(row.obj, 12, item * ROW_HEIGHT + 3);
+        lv_obj_clear_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+        stats.row_rebinds++;
+    }
+
+    // Rafraîchissement périodique : seuls les textes modifiés sont réécrits
+    if (strcmp(lv_label_get_text(row.name_label), reptile->name) != 0) {
+        lv_label_set_text(row.name_label, reptile->name);
+        stats.label_writes++;
+    }
+    uint8_t urgency = reptile_urgency(*reptile);
+    char detail[96];
+    snprintf(detail, sizeof(detail), "%s · Santé %u%% · Urgence %u",
+             get_species_data(reptile->species).common_name_fr,
+             reptile->health.overall_health, urgency);
+    if (strcmp(lv_label_get_text(row.detail_label), detail) != 0) {
+        lv_label_set_text(row.detail_label, detail);
+        stats.label_writes++;
+    }
+
+    uint8_t level = urgency >= ReptileListModel::URGENT_THRESHOLD ? 2 : (urgency >= 30 ? 1 : 0);
+    if (moved || level != row.urgency_level) {
+        static const uint32_t colors[] = {0xA3BE8C, 0xEBCB8B, 0xBF616A};
+        lv_obj_set_style_border_color(row.obj, lv_color_hex(colors[level]), 0);
+        lv_obj_set_style_border_width(row.obj, 6, 0);
+        row.urgency_level = level;
+    }
+}
+
+void ReptileListView::update(uint32_t now_ms) {
+    if (!container || now_ms - last_refresh_ms < REFRESH_MS) return;
+    last_refresh_ms = now_ms;
+
+    // Population modifiée, ou santé et urgence qui font bouger le tri ou le
+    // filtre : nouvel ordre ; sinon valeurs vivantes des lignes visibles
+    if (!refresh_order()) sync_window(true);
+}
+
+void ReptileListView::on_scroll(lv_event_t* e) {
+    ReptileListView* view = static_cast<ReptileListView*>(lv_event_get_user_data(e));
+    // L'inertie du défilement arrive par les animations de lv_timer_handler,
+    // hors du verrou du moteur pris autour des lectures de l'interface
+    std::lock_guard<std::recursive_mutex> lock(view->engine->storage_mutex());
+    view->sync_window(false);
+}
+
+void ReptileListView::on_row_click(lv_event_t* e) {
+    ReptileListView* view = static_cast<ReptileListView*>(lv_event_get_user_data(e));
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+    uint8_t slot = static_cast<uint8_t>((intptr_t)lv_obj_get_user_data(obj));
+    int32_t item = view->window.slot_item(slot);
+    if (item == VirtualWindow::NO_ITEM || (size_t)item >= view->model.size()) return;
+
+    uint16_t index = view->model.engine_index(item);
+    view->engine->select_reptile(index);
+    if (view->on_select) view->on_select(view->select_context, index);
+}
+
+void ReptileListView::on_sort_changed(lv_event_t* e) {
+    ReptileListView* view = static_cast<ReptileListView*>(lv_event_get_user_data(e));
+    lv_obj_t* dropdown = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    view->model.set_sort((ReptileSort)lv_dropdown_get_selected(dropdown));
+    view->refresh_order();
+}
+
+void ReptileListView::on_filter_changed(lv_event_t* e) {
+    ReptileListView* view = static_cast<ReptileListView*>(lv_event_get_user_data(e));
+    lv_obj_t* dropdown = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    view->model.set_filter((ReptileFilter)lv_dropdown_get_selected(dropdown));
+    lv_obj_scroll_to_y(view->container, 0, LV_ANIM_OFF);
+    view->refresh_order();
+}
+
+void ReptileListView::on_species_changed(lv_event_t* e) {
+    ReptileListView* view = static_cast<ReptileListView*>(lv_event_get_user_data(e));
+    lv_obj_t* dropdown = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    uint32_t selected = lv_dropdown_get_selected(dropdown);
+    view->model.set_species(selected == 0 ? ReptileListModel::ALL_SPECIES : (int16_t)(selected - 1));
+    lv_obj_scroll_to_y(view->container, 0, LV_ANIM_OFF);
+    view->refresh_order();
+}
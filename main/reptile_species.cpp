@@ -2,7 +2,7 @@
 #include <cstring>
 
 // Base de données scientifique ultra-précise basée sur les dernières recherches
-const SpeciesData SPECIES_DATABASE[10] = {
+const SpeciesData SPECIES_DATABASE[REPTILE_SPECIES_COUNT] = {
     // Pogona vitticeps - Dragon barbu central
     {
         .scientific_name = "Pogona vitticeps",
@@ -0,0 +1,385 @@
+#include "include/save_format.h"
+#include "include/crc32c.h"
+#include "esp_log.h"
+#include <cstddef>
+#include <cstring>
+
+static const char* TAG = "SaveFormat";
+
+static inline size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static inline size_t sections_offset() {
+    return sizeof(SaveImageHeader);
+}
+
+static inline size_t reptile_section_offset(uint16_t section_count) {
+    return align_up(sections_offset() + section_count * sizeof(SaveSectionEntry), SAVE_IMAGE_ALIGN);
+}
+
+uint32_t save_checksum(const uint8_t* data, size_t size) {
+    uint32_t checksum = 0;
+    for (size_t i = 0; i < size; i++) {
+        checksum = (checksum << 1) ^ data[i];
+    }
+    return checksum;
+}
+
+uint32_t save_header_crc(const SaveImageHeader& header, const SaveSectionEntry* sections) {
+    uint32_t crc = crc32c(&header, offsetof(SaveImageHeader, checksum));
+    return crc32c(sections, header.section_count * sizeof(SaveSectionEntry), crc);
+}
+
+size_t save_record_stride() {
+    return align_up(sizeof(SaveReptileRecord), alignof(SaveReptileRecord));
+}
+
+size_t save_image_size(size_t reptile_count) {
+    return reptile_section_offset(1) + reptile_count * save_record_stride();
+}
+
+size_t save_record_offset(size_t index) {
+    return reptile_section_offset(1) + index * save_record_stride();
+}
+
+void encode_reptile_record(const Reptile& reptile, uint8_t* record) {
+    SaveReptileRecord* r = reinterpret_cast<SaveReptileRecord*>(record);
+    memcpy(&r->reptile, &reptile, sizeof(Reptile));
+    r->crc = crc32c(&reptile, sizeof(Reptile));
+    memset(record + sizeof(SaveReptileRecord), 0, save_record_stride() - sizeof(SaveReptileRecord));
+}
+
+size_t seal_save_image(uint8_t* image, size_t count, uint32_t sequence, uint32_t timestamp) {
+    SaveSectionEntry* section = reinterpret_cast<SaveSectionEntry*>(image + sections_offset());
+    section->id = SAVE_SECTION_REPTILES;
+    section->record_stride = static_cast<uint16_t>(save_record_stride());
+    section->offset = static_cast<uint32_t>(reptile_section_offset(1));
+    section->record_count = static_cast<uint32_t>(count);
+    section->size = static_cast<uint32_t>(count * save_record_stride());
+
+    SaveImageHeader* header = reinterpret_cast<SaveImageHeader*>(image);
+    memset(header, 0, sizeof(SaveImageHeader));
+    header->magic = SAVE_IMAGE_MAGIC;
+    header->version = SAVE_FORMAT_VERSION;
+    header->header_size = sizeof(SaveImageHeader);
+    header->image_size = static_cast<uint32_t>(save_image_size(count));
+    header->sequence = sequence;
+    header->timestamp = timestamp;
+    header->section_count = 1;
+    header->checksum = save_header_crc(*header, section);
+    return header->image_size;
+}
+
+static bool memory_sink(void* ctx, uint32_t, size_t offset, const uint8_t* data, size_t size) {
+    uint8_t* out = static_cast<uint8_t*>(ctx);
+    memcpy(out + offset, data, size);
+    return true;
+}
+
+size_t encode_save_image(const Reptile* reptiles, size_t count,
+                         uint32_t sequence, uint32_t timestamp,
+                         uint8_t* out, size_t out_size) {
+    size_t total_size = save_image_size(count);
+    if (total_size > out_size) {
+        ESP_LOGE(TAG, "Image trop grande: %zu > %zu", total_size, out_size);
+        return 0;
+    }
+
+    memset(out, 0, reptile_section_offset(1));
+
+    SaveStreamWriter writer;
+    writer.begin(memory_sink, out, 1);
+    writer.begin_section(SAVE_SECTION_REPTILES, save_record_stride());
+    for (size_t i = 0; i < count; i++) {
+        writer.append_reptile(reptiles[i]);
+    }
+    writer.end_section();
+    return writer.finish(sequence, timestamp) ? writer.image_size() : 0;
+}
+
+void SaveStreamWriter::begin(SinkFn sink_fn, void* ctx, uint16_t sections_expected) {
+    sink = sink_fn;
+    sink_ctx = ctx;
+    declared_sections = sections_expected;
+    section_count = 0;
+    section_open = false;
+    failed = sections_expected > MAX_SECTIONS;
+
+    // Les données commencent après l'en-tête et la table réservés
+    current_chunk = 0;
+    chunk_fill = 0;
+    chunk_offset = reptile_section_offset(sections_expected);
+    segment = 0;
+}
+
+bool SaveStreamWriter::flush_chunk() {
+    if (chunk_fill == 0) return true;
+    if (!sink(sink_ctx, segment, chunk_offset, chunks[current_chunk], chunk_fill)) {
+        ESP_LOGE(TAG, "Échec écriture segment %u", (unsigned)segment);
+        failed = true;
+        return false;
+    }
+    segment++;
+    chunk_offset += chunk_fill;
+    chunk_fill = 0;
+    current_chunk = (current_chunk + 1) % CHUNK_COUNT;
+    return true;
+}
+
+bool SaveStreamWriter::put(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0 && !failed) {
+        size_t len = CHUNK_SIZE - chunk_fill < size ? CHUNK_SIZE - chunk_fill : size;
+        if (bytes) {
+            memcpy(chunks[current_chunk] + chunk_fill, bytes, len);
+            bytes += len;
+        } else {
+            memset(chunks[current_chunk] + chunk_fill, 0, len); // Bourrage
+        }
+        chunk_fill += len;
+        size -= len;
+        if (chunk_fill == CHUNK_SIZE) {
+            flush_chunk();
+        }
+    }
+    return !failed;
+}
+
+bool SaveStreamWriter::begin_section(uint16_t id, uint16_t record_stride) {
+    if (failed || section_open || section_count >= declared_sections) {
+        failed = true;
+        return false;
+    }
+    put(nullptr, align_up(position(), SAVE_IMAGE_ALIGN) - position());
+
+    SaveSectionEntry& section = sections[section_count];
+    section.id = id;
+    section.record_stride = record_stride;
+    section.offset = static_cast<uint32_t>(position());
+    section.record_count = 0;
+    section.size = 0;
+    section_crc = 0;
+    section_open = true;
+    return !failed;
+}
+
+bool SaveStreamWriter::append(const void* data, size_t size) {
+    if (!section_open) {
+        failed = true;
+        return false;
+    }
+    sections[section_count].size += size;
+    if (sections[section_count].record_stride == 0 && data) {
+        section_crc = crc32c(data, size, section_crc);
+    }
+    return put(data, size);
+}
+
+bool SaveStreamWriter::append_reptile(const Reptile& reptile) {
+    if (!section_open) {
+        failed = true;
+        return false;
+    }
+    SaveSectionEntry& section = sections[section_count];
+    uint32_t crc = crc32c(&reptile, sizeof(Reptile));
+    append(&reptile, sizeof(Reptile));
+    append(&crc, sizeof(crc));
+    append(nullptr, section.record_stride - sizeof(SaveReptileRecord));
+    section.record_count++;
+    return !failed;
+}
+
+void SaveStreamWriter::end_section() {
+    if (section_open) {
+        if (sections[section_count].record_stride == 0) {
+            put(&section_crc, sizeof(section_crc)); // Hors `size`
+        }
+        section_count++;
+        section_open = false;
+    }
+}
+
+bool SaveStreamWriter::finish(uint32_t sequence, uint32_t timestamp) {
+    end_section();
+    if (failed || section_count != declared_sections || !flush_chunk()) {
+        return false;
+    }
+
+    SaveImageHeader header = {};
+    header.magic = SAVE_IMAGE_MAGIC;
+    header.version = SAVE_FORMAT_VERSION;
+    header.header_size = sizeof(SaveImageHeader);
+    header.image_size = static_cast<uint32_t>(position());
+    header.sequence = sequence;
+    header.timestamp = timestamp;
+    header.section_count = section_count;
+    header.checksum = save_header_crc(header, sections);
+
+    // Table puis en-tête : l'image devient valide avec la dernière écriture
+    if (!sink(sink_ctx, segment, sections_offset(), reinterpret_cast<const uint8_t*>(sections),
+              section_count * sizeof(SaveSectionEntry)) ||
+        !sink(sink_ctx, segment, 0, reinterpret_cast<const uint8_t*>(&header), sizeof(header))) {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool decode_legacy_save(const uint8_t* blob, size_t size, std::vector<Reptile>& reptiles) {
+    if (size < sizeof(LegacySaveHeader)) {
+        ESP_LOGE(TAG, "Données v1 corrompues - taille insuffisante");
+        return false;
+    }
+
+    LegacySaveHeader header;
+    memcpy(&header, blob, sizeof(header));
+    if (header.version != SAVE_FORMAT_LEGACY) {
+        ESP_LOGE(TAG, "Version v1 inattendue: %u", (unsigned)header.version);
+        return false;
+    }
+
+    const uint8_t* data = blob + sizeof(LegacySaveHeader);
+    size_t data_size = size - sizeof(LegacySaveHeader);
+    if (save_checksum(data, data_size) != header.checksum) {
+        ESP_LOGE(TAG, "Données v1 corrompues - checksum invalide");
+        return false;
+    }
+    if (data_size % sizeof(Reptile) != 0) {
+        ESP_LOGE(TAG, "Taille données v1 incohérente");
+        return false;
+    }
+
+    reptiles.resize(data_size / sizeof(Reptile));
+    memcpy(reptiles.data(), data, data_size);
+    return true;
+}
+
+bool SaveImageView::open(const uint8_t* data, size_t mapped_size) {
+    close();
+    if (!data || mapped_size < sizeof(SaveImageHeader)) return false;
+
+    const SaveImageHeader* header = reinterpret_cast<const SaveImageHeader*>(data);
+    if (header->magic != SAVE_IMAGE_MAGIC) {
+        return false; // Slot vierge ou effacé
+    }
+    if ((header->version != SAVE_FORMAT_VERSION && header->version != SAVE_FORMAT_MAPPED_V2) ||
+        header->header_size != sizeof(SaveImageHeader)) {
+        ESP_LOGE(TAG, "Version d'image non supportée: %u", header->version);
+        return false;
+    }
+    if (header->image_size > mapped_size ||
+        sections_offset() + header->section_count * sizeof(SaveSectionEntry) > header->image_size) {
+        ESP_LOGE(TAG, "Image hors des pages projetées: %u > %zu", (unsigned)header->image_size, mapped_size);
+        return false;
+    }
+
+    const SaveSectionEntry* sections = reinterpret_cast<const SaveSectionEntry*>(data + sections_offset());
+    uint32_t expected = header->version == SAVE_FORMAT_MAPPED_V2
+        ? save_checksum(data + sizeof(SaveImageHeader), header->image_size - sizeof(SaveImageHeader))
+        : save_header_crc(*header, sections);
+    if (expected != header->checksum) {
+        ESP_LOGE(TAG, "En-tête corrompu - checksum invalide");
+        return false;
+    }
+
+    const SaveSectionEntry* reptiles = nullptr;
+    for (uint16_t i = 0; i < header->section_count; i++) {
+        const SaveSectionEntry& s = sections[i];
+        if (s.offset % SAVE_IMAGE_ALIGN != 0 || s.offset > header->image_size ||
+            s.size > header->image_size - s.offset ||
+            (s.record_stride && (uint64_t)s.record_count * s.record_stride > s.size) ||
+            (!s.record_stride && header->version == SAVE_FORMAT_VERSION &&
+             s.size + sizeof(uint32_t) > header->image_size - s.offset)) {
+            ESP_LOGE(TAG, "Section %u invalide", s.id);
+            return false;
+        }
+        if (s.id == SAVE_SECTION_REPTILES) {
+            size_t min_stride = header->version == SAVE_FORMAT_MAPPED_V2 ? sizeof(Reptile)
+                                                                          : sizeof(SaveReptileRecord);
+            if (s.record_stride < min_stride || s.record_stride % alignof(Reptile) != 0) {
+                ESP_LOGE(TAG, "Pas d'enregistrement invalide: %u", s.record_stride);
+                return false;
+            }
+            reptiles = &s;
+        }
+    }
+
+    base = data;
+    hdr = header;
+    reptile_section = reptiles;
+    return true;
+}
+
+void SaveImageView::close() {
+    base = nullptr;
+    hdr = nullptr;
+    reptile_section = nullptr;
+}
+
+const SaveSectionEntry* SaveImageView::find_section(uint16_t id) const {
+    if (!hdr) return nullptr;
+    const SaveSectionEntry* sections = reinterpret_cast<const SaveSectionEntry*>(base + sections_offset());
+    for (uint16_t i = 0; i < hdr->section_count; i++) {
+        if (sections[i].id == id) return &sections[i];
+    }
+    return nullptr;
+}
+
+const SaveSectionEntry* SaveImageView::section_at(uint16_t index) const {
+    if (index >= section_count()) return nullptr;
+    return reinterpret_cast<const SaveSectionEntry*>(base + sections_offset()) + index;
+}
+
+const uint8_t* SaveImageView::section_data(const SaveSectionEntry& section) const {
+    return base ? base + section.offset : nullptr;
+}
+
+bool SaveImageView::section_valid(const SaveSectionEntry& section) const {
+    if (!hdr || section.record_stride != 0) return false;
+    if (hdr->version == SAVE_FORMAT_MAPPED_V2) return true;
+    uint32_t stored;
+    memcpy(&stored, base + section.offset + section.size, sizeof(stored));
+    return stored == crc32c(base + section.offset, section.size);
+}
+
+size_t SaveImageView::reptile_count() const {
+    return reptile_section ? reptile_section->record_count : 0;
+}
+
+size_t SaveImageView::reptile_stride() const {
+    return reptile_section ? reptile_section->record_stride : 0;
+}
+
+const uint8_t* SaveImageView::reptile_records() const {
+    return reptile_section ? base + reptile_section->offset : nullptr;
+}
+
+const Reptile* SaveImageView::reptile(size_t index) const {
+    if (index >= reptile_count()) return nullptr;
+    return reinterpret_cast<const Reptile*>(reptile_records() + index * reptile_section->record_stride);
+}
+
+bool SaveImageView::record_valid(size_t index) const {
+    const Reptile* record = reptile(index);
+    if (!record) return false;
+    if (hdr->version == SAVE_FORMAT_MAPPED_V2) return true;
+    return reinterpret_cast<const SaveReptileRecord*>(record)->crc == crc32c(record, sizeof(Reptile));
+}
+
+size_t SaveImageView::count_valid_records() const {
+    size_t valid = 0;
+    for (size_t i = 0; i < reptile_count(); i++) {
+        if (record_valid(i)) valid++;
+    }
+    return valid;
+}
+
+size_t SaveImageView::copy_valid_reptiles(std::vector<Reptile>& reptiles) const {
+    reptiles.clear();
+    reptiles.reserve(reptile_count());
+    for (size_t i = 0; i < reptile_count(); i++) {
+        if (record_valid(i)) reptiles.push_back(*reptile(i));
+    }
+    return reptile_count() - reptiles.size();
+}
@@ -0,0 +1,202 @@
+#include "include/save_partition.h"
+#include "esp_log.h"
+#include <cstring>
+
+#ifndef ESP_PLATFORM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char* TAG = "SavePartition";
+
+static constexpr size_t PARTITION_SPAN = SavePartition::SLOT_SIZE * SavePartition::SLOT_COUNT;
+
+SavePartition::~SavePartition() {
+    close();
+}
+
+bool SavePartition::erase_slot(uint8_t slot, size_t size) {
+    return erase_range(slot, 0, size);
+}
+
+bool SavePartition::erase_range(uint8_t slot, size_t offset, size_t size) {
+    size_t erase_size = (size + SECTOR_SIZE - 1) / SECTOR_SIZE * SECTOR_SIZE;
+    if (!is_open() || slot >= SLOT_COUNT || offset % SECTOR_SIZE != 0 ||
+        offset + erase_size > SLOT_SIZE) {
+        return false;
+    }
+#ifdef ESP_PLATFORM
+    esp_err_t err = esp_partition_erase_range(partition, slot * SLOT_SIZE + offset, erase_size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Erreur effacement slot %d: %s", slot, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+#else
+    uint8_t erased[SECTOR_SIZE];
+    memset(erased, 0xFF, sizeof(erased));
+    for (size_t off = 0; off < erase_size; off += SECTOR_SIZE) {
+        if (pwrite(fd, erased, SECTOR_SIZE, slot * SLOT_SIZE + offset + off) != (ssize_t)SECTOR_SIZE) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+bool SavePartition::write(uint8_t slot, size_t offset, const void* data, size_t size) {
+    if (!is_open() || slot >= SLOT_COUNT || offset + size > SLOT_SIZE) return false;
+#ifdef ESP_PLATFORM
+    esp_err_t err = esp_partition_write(partition, slot * SLOT_SIZE + offset, data, size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Erreur écriture slot %d: %s", slot, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+#else
+    return pwrite(fd, data, size, slot * SLOT_SIZE + offset) == (ssize_t)size;
+#endif
+}
+
+bool SavePartition::read(uint8_t slot, size_t offset, void* data, size_t size) const {
+    if (!is_open() || slot >= SLOT_COUNT || offset + size > SLOT_SIZE) return false;
+#ifdef ESP_PLATFORM
+    return esp_partition_read(partition, slot * SLOT_SIZE + offset, data, size) == ESP_OK;
+#else
+    return pread(fd, data, size, slot * SLOT_SIZE + offset) == (ssize_t)size;
+#endif
+}
+
+bool SavePartition::copy_slot(uint8_t from, uint8_t to, size_t size) {
+    if (from == to || size > SLOT_SIZE) return false;
+    if (mapped_slot == to) unmap();
+    if (!erase_slot(to, size)) return false;
+
+    uint8_t chunk[256];
+    for (size_t off = 0; off < size; off += sizeof(chunk)) {
+        size_t len = size - off < sizeof(chunk) ? size - off : sizeof(chunk);
+        if (!read(from, off, chunk, len) || !write(to, off, chunk, len)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef ESP_PLATFORM
+
+bool SavePartition::open() {
+    if (partition) return true;
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, PARTITION_LABEL);
+    if (!partition) {
+        ESP_LOGE(TAG, "Partition '%s' introuvable", PARTITION_LABEL);
+        return false;
+    }
+    if (partition->size < PARTITION_SPAN) {
+        ESP_LOGE(TAG, "Partition trop petite: %u < %u", (unsigned)partition->size, (unsigned)PARTITION_SPAN);
+        partition = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void SavePartition::close() {
+    unmap();
+    partition = nullptr;
+}
+
+bool SavePartition::is_open() const {
+    return partition != nullptr;
+}
+
+const uint8_t* SavePartition::map_slot(uint8_t slot) {
+    if (!is_open() || slot >= SLOT_COUNT) return nullptr;
+    if (mapped_slot == slot) return mapped;
+    unmap();
+
+    const void* ptr = nullptr;
+    esp_err_t err = esp_partition_mmap(partition, slot * SLOT_SIZE, SLOT_SIZE,
+                                       ESP_PARTITION_MMAP_DATA, &ptr, &mmap_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Erreur projection slot %d: %s", slot, esp_err_to_name(err));
+        return nullptr;
+    }
+    mapped = static_cast<const uint8_t*>(ptr);
+    mapped_slot = slot;
+    return mapped;
+}
+
+void SavePartition::unmap() {
+    if (mapped) {
+        esp_partition_munmap(mmap_handle);
+    }
+    mapped = nullptr;
+    mapped_slot = SLOT_COUNT;
+}
+
+#else
+
+const char* SavePartition::host_path = "reptile_save.img";
+
+void SavePartition::set_host_path(const char* path) {
+    host_path = path;
+}
+
+bool SavePartition::open() {
+    if (fd >= 0) return true;
+    fd = ::open(host_path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        ESP_LOGE(TAG, "Ouverture image hôte impossible: %s", host_path);
+        return false;
+    }
+
+    // Un fichier neuf est initialisé comme une flash effacée
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size < PARTITION_SPAN) {
+        uint8_t erased[SECTOR_SIZE];
+        memset(erased, 0xFF, sizeof(erased));
+        for (size_t off = st.st_size / SECTOR_SIZE * SECTOR_SIZE; off < PARTITION_SPAN; off += SECTOR_SIZE) {
+            pwrite(fd, erased, SECTOR_SIZE, off);
+        }
+    }
+
+    void* ptr = mmap(nullptr, PARTITION_SPAN, PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+    host_map = static_cast<uint8_t*>(ptr);
+    return true;
+}
+
+void SavePartition::close() {
+    unmap();
+    if (host_map) {
+        munmap(host_map, PARTITION_SPAN);
+        host_map = nullptr;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool SavePartition::is_open() const {
+    return fd >= 0;
+}
+
+const uint8_t* SavePartition::map_slot(uint8_t slot) {
+    if (!is_open() || slot >= SLOT_COUNT) return nullptr;
+    mapped = host_map + slot * SLOT_SIZE;
+    mapped_slot = slot;
+    return mapped;
+}
+
+void SavePartition::unmap() {
+    mapped = nullptr;
+    mapped_slot = SLOT_COUNT;
+}
+
+#endif
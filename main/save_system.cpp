@@ -5,6 +5,25 @@
 #include <cstring>
 #include <algorithm>
 
+#include <cstdlib>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+// Écriture des sections de composant dans le flux de l'image
+class StreamSectionOutput : public PersistenceOutput {
+private:
+    SaveStreamWriter& writer;
+
+public:
+    explicit StreamSectionOutput(SaveStreamWriter& w) : writer(w) {}
+    bool write(const void* data, size_t size) override { return writer.append(data, size); }
+};
+
 static const char* TAG = "SaveSystem";
 
 // Constantes de sauvegarde
@@ -14,20 +33,22 @@ const char* SaveSystem::KEY_REPTILE_DATA = "reptile_data";
 const char* SaveSystem::KEY_GAME_SETTINGS = "game_cfg";
 const char* SaveSystem::KEY_SAVE_VERSION = "save_ver";
 const char* SaveSystem::KEY_LAST_SAVE_TIME = "last_save";
+const char* SaveSystem::KEY_ACTIVE_SLOT = "save_slot";
+const char* SaveSystem::KEY_FLASH_WEAR = "flash_wear";
 const char* SaveSystem::KEY_REPTILE_COUNT_BACKUP = "reptile_cnt_bak";
 const char* SaveSystem::KEY_REPTILE_DATA_BACKUP = "reptile_data_bak";
 const char* SaveSystem::KEY_SAVE_VERSION_BACKUP = "save_ver_bak";
 const char* SaveSystem::KEY_LAST_SAVE_TIME_BACKUP = "last_save_bak";
 
-#define CURRENT_SAVE_VERSION 1
-#define MAX_REPTILES 20
-#define SAVE_DATA_MAGIC 0x52455054
+#define CURRENT_SAVE_VERSION SAVE_FORMAT_VERSION
 
 SaveSystem::SaveSystem(GameEngine* engine)
     : game_engine(engine), statistics{} {
 }
 
 SaveSystem::~SaveSystem() {
+    release_mapping();
+    free(warm_image);
     if (is_initialized) {
         nvs_close(nvs_handle);
     }
@@ -40,12 +61,57 @@ bool SaveSystem::initialize() {
         return false;
     }
     
+    if (!partition.open()) {
+        ESP_LOGE(TAG, "Partition de sauvegarde indisponible");
+        nvs_close(nvs_handle);
+        return false;
+    }
+    
     is_initialized = true;
     ESP_LOGI(TAG, "Système de sauvegarde initialisé");
     
+    // Tampon d'urgence alloué une fois pour toutes (PSRAM de préférence) :
+    // emergency_save() n'allouera rien quand le tas sera presque vide
+    if (!warm_image) {
+        warm_capacity = SavePartition::SLOT_SIZE;
+#ifdef ESP_PLATFORM
+        warm_image = static_cast<uint8_t*>(heap_caps_malloc(warm_capacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if (!warm_image) {
+            warm_capacity = save_image_size(32);
+            warm_image = static_cast<uint8_t*>(heap_caps_malloc(warm_capacity, MALLOC_CAP_8BIT));
+        }
+#else
+        warm_image = static_cast<uint8_t*>(malloc(warm_capacity));
+#endif
+        if (!warm_image) {
+            warm_capacity = 0;
+            ESP_LOGW(TAG, "Tampon de sauvegarde d'urgence indisponible");
+        }
+        statistics.emergency_buffer_bytes = warm_capacity;
+    }
+    
+    // Slot actif de la dernière sauvegarde validée
+    uint8_t slot = 0;
+    size_t required_size = sizeof(slot);
+    if (nvs_get_blob(nvs_handle, KEY_ACTIVE_SLOT, &slot, &required_size) == ESP_OK &&
+        slot <= SavePartition::SLOT_PRIMARY_B) {
+        active_slot = slot;
+    }
+    
+    // Usure cumulée de la zone A/B, conservée d'un démarrage à l'autre
+    AutosavePolicy::Config policy = autosave_policy.get_config();
+    policy.wear_area_bytes = 2 * SavePartition::SLOT_SIZE;
+    autosave_policy.configure(policy);
+    uint64_t wear = 0;
+    required_size = sizeof(wear);
+    if (nvs_get_blob(nvs_handle, KEY_FLASH_WEAR, &wear, &required_size) == ESP_OK) {
+        autosave_policy.set_lifetime_erased(wear);
+    }
+    update_wear_stats();
+    
     // Vérifier la version de sauvegarde
     uint32_t stored_version = 0;
-    size_t required_size = sizeof(stored_version);
+    required_size = sizeof(stored_version);
     err = nvs_get_blob(nvs_handle, KEY_SAVE_VERSION, &stored_version, &required_size);
 
     if (err == ESP_OK) {
@@ -54,22 +120,13 @@ bool SaveSystem::initialize() {
             return false;
         }
         if (stored_version < CURRENT_SAVE_VERSION) {
-            ESP_LOGW(TAG, "Migration sauvegarde %d -> %d", stored_version, CURRENT_SAVE_VERSION);
-            save_version = CURRENT_SAVE_VERSION;
-            err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION, &save_version, sizeof(save_version));
-            if (err != ESP_OK) {
-                ESP_LOGE(TAG, "Erreur mise à jour version: %s", esp_err_to_name(err));
-                return false;
-            }
-            if (nvs_commit(nvs_handle) != ESP_OK) {
-                ESP_LOGE(TAG, "Erreur commit après migration");
-                return false;
-            }
+            // La conversion des données est faite par load_game_data()
+            ESP_LOGW(TAG, "Sauvegarde v%d à migrer vers v%d", stored_version, CURRENT_SAVE_VERSION);
         }
     } else if (err == ESP_ERR_NVS_NOT_FOUND) {
         ESP_LOGI(TAG, "Première initialisation du système de sauvegarde");
         save_version = CURRENT_SAVE_VERSION;
-        err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION, &save_version, sizeof(save_version));
+        err = write_key(KEY_SAVE_VERSION, &save_version, sizeof(save_version));
         if (err == ESP_OK) {
             nvs_commit(nvs_handle);
         }
@@ -82,24 +139,36 @@ bool SaveSystem::initialize() {
 }
 
 bool SaveSystem::save_game_data() {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized || !game_engine) {
         ESP_LOGE(TAG, "Système non initialisé");
         return false;
     }
 
+    // Reptiles encore projetés et sections propres : rien n'a changé depuis le chargement
+    if (game_engine->has_mapped_reptiles() && sections.dirty_count() == 0) {
+        ESP_LOGI(TAG, "Aucune modification depuis le chargement");
+        return true;
+    }
+
     uint32_t start_time = esp_timer_get_time() / 1000;
     statistics.total_saves++;
     ESP_LOGI(TAG, "Début sauvegarde...");
 
-    // Récupérer les reptiles du moteur de jeu
-    std::vector<Reptile> reptiles = game_engine->get_reptiles();
+    // Référence directe sur les reptiles du moteur (copie seulement si projetés)
+    uint64_t phase_start = esp_timer_get_time();
+    const std::vector<Reptile>& reptiles = game_engine->get_reptiles();
+    telemetry.record_phase(SAVE_PHASE_SNAPSHOT, esp_timer_get_time() - phase_start);
+    
     if (!save_reptiles(reptiles)) {
         statistics.failed_saves++;
         return false;
     }
 
     // Sauvegarder la version
-    esp_err_t err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION, &save_version, sizeof(save_version));
+    phase_start = esp_timer_get_time();
+    save_version = CURRENT_SAVE_VERSION;
+    esp_err_t err = write_key(KEY_SAVE_VERSION, &save_version, sizeof(save_version));
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Erreur sauvegarde version: %s", esp_err_to_name(err));
         statistics.failed_saves++;
@@ -108,31 +177,40 @@ bool SaveSystem::save_game_data() {
 
     // Sauvegarder le timestamp
     uint32_t current_time = esp_timer_get_time() / 1000;
-    err = nvs_set_blob(nvs_handle, KEY_LAST_SAVE_TIME, &current_time, sizeof(current_time));
+    err = write_key(KEY_LAST_SAVE_TIME, &current_time, sizeof(current_time));
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Erreur sauvegarde timestamp: %s", esp_err_to_name(err));
         statistics.failed_saves++;
         return false;
     }
+    
+    // Usure cumulée, validée avec le reste
+    uint64_t wear = autosave_policy.get_lifetime_erased();
+    write_key(KEY_FLASH_WEAR, &wear, sizeof(wear));
 
-    // Valider les modifications
+    // Valider les modifications (bascule du slot actif incluse)
     err = nvs_commit(nvs_handle);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Erreur commit NVS: %s", esp_err_to_name(err));
         statistics.failed_saves++;
         return false;
     }
+    telemetry.record_phase(SAVE_PHASE_COMMIT, esp_timer_get_time() - phase_start);
 
     uint32_t end_time = esp_timer_get_time() / 1000;
     statistics.successful_saves++;
     statistics.last_save_duration_ms = end_time - start_time;
     statistics.save_data_size = get_save_size();
+    game_engine->clear_changes();
+    sections.mark_all_clean();
+    update_wear_stats();
     ESP_LOGI(TAG, "Sauvegarde terminée en %d ms", end_time - start_time);
 
     return true;
 }
 
 bool SaveSystem::load_game_data() {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized || !game_engine) {
         ESP_LOGE(TAG, "Système non initialisé");
         return false;
@@ -160,219 +238,272 @@ bool SaveSystem::load_game_data() {
         return false;
     }
 
-    if (stored_version < CURRENT_SAVE_VERSION) {
+    if (stored_version < SAVE_FORMAT_MAPPED_V2) {
+        // Migration v1 : décodage du blob NVS puis réécriture en partition
         ESP_LOGW(TAG, "Migration sauvegarde %d -> %d", stored_version, CURRENT_SAVE_VERSION);
-        save_version = CURRENT_SAVE_VERSION;
-        err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION, &save_version, sizeof(save_version));
-        if (err == ESP_OK) {
-            nvs_commit(nvs_handle);
+        std::vector<Reptile> reptiles;
+        if (!load_legacy_reptiles(reptiles)) {
+            return false;
         }
+        game_engine->set_reptiles(reptiles);
+        if (save_game_data()) {
+            erase_legacy_keys();
+        }
+        return true;
     }
 
-    // Charger les reptiles
-    std::vector<Reptile> reptiles;
-    if (!load_reptiles(reptiles)) {
+    // Une sauvegarde d'urgence plus récente que l'image active est reprise
+    SaveImageView view;
+    bool has_image = map_active_image(view);
+    if (has_image) {
+        attach_sections(view);
+    }
+    SaveImageHeader emergency;
+    if (partition.read(SavePartition::SLOT_EMERGENCY, 0, &emergency, sizeof(emergency)) &&
+        emergency.magic == SAVE_IMAGE_MAGIC && (!has_image || emergency.sequence > save_sequence) &&
+        recover_emergency_image()) {
+        return true;
+    }
+
+    // Projection de l'image : les reptiles sont lus en place
+    if (!has_image || !map_active_image(view)) {
+        ESP_LOGI(TAG, "Aucune image de sauvegarde valide");
         return false;
     }
-    game_engine->set_reptiles(reptiles);
+    size_t valid = view.count_valid_records();
+    if (valid == view.reptile_count()) {
+        game_engine->attach_mapped_reptiles(view.reptile_records(), view.reptile_stride(),
+                                            view.reptile_count());
+    } else {
+        // Récupération partielle : seuls les enregistrements intacts sont copiés
+        ESP_LOGW(TAG, "%zu/%zu enregistrements corrompus écartés",
+                 view.reptile_count() - valid, view.reptile_count());
+        std::vector<Reptile> recovered;
+        view.copy_valid_reptiles(recovered);
+        game_engine->set_reptiles(recovered);
+        statistics.recovered_records += valid;
+        statistics.dropped_records += view.reptile_count() - valid;
+    }
 
     ESP_LOGI(TAG, "Données chargées avec succès (version %d)", stored_version);
     return true;
 }
 
 bool SaveSystem::save_reptiles(const std::vector<Reptile>& reptiles) {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized) return false;
     
-    if (reptiles.size() > MAX_REPTILES) {
+    size_t section_bytes = sections.total_size() +
+        sections.size() * (SAVE_IMAGE_ALIGN + sizeof(SaveSectionEntry) + sizeof(uint32_t));
+    if (save_image_size(reptiles.size()) + section_bytes > SavePartition::SLOT_SIZE) {
         ESP_LOGE(TAG, "Trop de reptiles à sauvegarder: %zu", reptiles.size());
         return false;
     }
     
     ESP_LOGI(TAG, "Sauvegarde de %zu reptiles", reptiles.size());
     
-    // Sauvegarder le nombre de reptiles
-    uint16_t reptile_count = reptiles.size();
-    esp_err_t err = nvs_set_blob(nvs_handle, KEY_REPTILE_COUNT, &reptile_count, sizeof(reptile_count));
+    // Écriture dans le slot inactif : l'image active reste intacte
+    uint8_t target = inactive_slot();
+    if (partition.get_mapped_slot() == target) {
+        release_mapping();
+    }
+    
+    // Encodage en flux : mémoire constante quel que soit le nombre de reptiles
+    stream_slot = target;
+    stream_erased = 0;
+    stream_write_us = 0;
+    uint64_t encode_start = esp_timer_get_time();
+#ifdef ESP_PLATFORM
+    stream_heap_start = esp_get_free_heap_size();
+    stream_heap_min = stream_heap_start;
+#endif
+    writer.begin(partition_sink, this, 1 + sections.size());
+    writer.begin_section(SAVE_SECTION_REPTILES, save_record_stride());
+    for (const Reptile& reptile : reptiles) {
+        if (!writer.append_reptile(reptile)) break;
+    }
+    writer.end_section();
+    
+    // Toutes les sections de composant dans la même image : une seule
+    // écriture et un seul commit, qu'elles soient modifiées ou non
+    StreamSectionOutput output(writer);
+    bool sections_ok = true;
+    for (uint8_t i = 0; i < sections.size() && sections_ok; i++) {
+        PersistentSection* section = sections.get(i);
+        sections_ok = writer.begin_section(section->section_id(), 0) && section->serialize(output);
+        writer.end_section();
+    }
+    if (!sections_ok || !writer.finish(save_sequence + 1, esp_timer_get_time() / 1000)) {
+        ESP_LOGE(TAG, "Erreur écriture image slot %d", target);
+        return false;
+    }
+    uint32_t stream_us = esp_timer_get_time() - encode_start;
+    telemetry.record_phase(SAVE_PHASE_WRITE, stream_write_us);
+    telemetry.record_phase(SAVE_PHASE_ENCODE, stream_us > stream_write_us ? stream_us - stream_write_us : 0);
+    telemetry.record_key_write(SaveTelemetry::KEY_IMAGE, writer.image_size());
+    
+    esp_err_t err = write_key(KEY_ACTIVE_SLOT, &target, sizeof(target));
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur sauvegarde nombre reptiles: %s", esp_err_to_name(err));
+        ESP_LOGE(TAG, "Erreur sauvegarde slot actif: %s", esp_err_to_name(err));
         return false;
     }
     
-    // Sauvegarder les données des reptiles
-    if (!reptiles.empty()) {
-        // Créer un buffer compressé
-        uint8_t compressed_data[4096]; // 4KB max
-        size_t compressed_size = compress_reptile_data(reptiles, compressed_data, sizeof(compressed_data));
-        
-        if (compressed_size == 0) {
-            ESP_LOGE(TAG, "Erreur compression données reptiles");
-            return false;
-        }
-        
-        // Calculer le checksum
-        uint32_t checksum = calculate_checksum(compressed_data, compressed_size);
-        
-        // Créer l'en-tête de sauvegarde
-        SaveHeader header = {
-            .version = CURRENT_SAVE_VERSION,
-            .timestamp = (uint32_t)(esp_timer_get_time() / 1000),
-            .reptile_count = reptile_count,
-            .checksum = checksum
-        };
-        
-        // Buffer final avec en-tête + données
-        size_t total_size = sizeof(SaveHeader) + compressed_size;
-        uint8_t* save_buffer = new uint8_t[total_size];
-        
-        memcpy(save_buffer, &header, sizeof(SaveHeader));
-        memcpy(save_buffer + sizeof(SaveHeader), compressed_data, compressed_size);
-        
-        // Sauvegarder dans NVS
-        err = nvs_set_blob(nvs_handle, KEY_REPTILE_DATA, save_buffer, total_size);
-        
-        delete[] save_buffer;
-        
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Erreur sauvegarde données: %s", esp_err_to_name(err));
+    active_slot = target;
+    active_image_size = writer.image_size();
+    save_sequence++;
+    autosave_policy.record_write(esp_timer_get_time() / 1000, stream_erased);
+    
+    statistics.last_save_segments = writer.get_segment_count();
+    statistics.last_save_sections = sections.size();
+    statistics.stream_buffer_bytes = SaveStreamWriter::buffer_bytes();
+#ifdef ESP_PLATFORM
+    statistics.peak_heap_bytes = stream_heap_start - stream_heap_min;
+    statistics.min_free_stack_bytes = uxTaskGetStackHighWaterMark(nullptr);
+#endif
+    ESP_LOGI(TAG, "Image reptiles sauvegardée: %zu bytes en %u segments (slot %d)",
+             active_image_size, (unsigned)writer.get_segment_count(), target);
+    return true;
+}
+
+bool SaveSystem::partition_sink(void* ctx, uint32_t /*segment*/, size_t offset,
+                                const uint8_t* data, size_t size) {
+    SaveSystem* self = static_cast<SaveSystem*>(ctx);
+    uint64_t start = esp_timer_get_time();
+    
+    // Effacement des secteurs au fil de l'eau
+    if (offset + size > self->stream_erased) {
+        size_t erase_size = offset + size - self->stream_erased;
+        if (!self->partition.erase_range(self->stream_slot, self->stream_erased, erase_size)) {
             return false;
         }
-        
-        ESP_LOGI(TAG, "Données reptiles sauvegardées: %zu bytes (compressées: %zu)", 
-                 total_size, compressed_size);
+        self->stream_erased += (erase_size + SavePartition::SECTOR_SIZE - 1) /
+                               SavePartition::SECTOR_SIZE * SavePartition::SECTOR_SIZE;
     }
     
-    return true;
+    bool ok = self->partition.write(self->stream_slot, offset, data, size);
+    self->stream_write_us += esp_timer_get_time() - start;
+#ifdef ESP_PLATFORM
+    uint32_t free_heap = esp_get_free_heap_size();
+    if (free_heap < self->stream_heap_min) self->stream_heap_min = free_heap;
+#endif
+    return ok;
 }
 
 bool SaveSystem::load_reptiles(std::vector<Reptile>& reptiles) {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized) return false;
     
-    // Charger le nombre de reptiles
-    uint16_t reptile_count = 0;
-    size_t required_size = sizeof(reptile_count);
-    esp_err_t err = nvs_get_blob(nvs_handle, KEY_REPTILE_COUNT, &reptile_count, &required_size);
+    uint32_t stored_version = 0;
+    size_t required_size = sizeof(stored_version);
+    if (nvs_get_blob(nvs_handle, KEY_SAVE_VERSION, &stored_version, &required_size) == ESP_OK &&
+        stored_version < SAVE_FORMAT_MAPPED_V2) {
+        return load_legacy_reptiles(reptiles);
+    }
     
-    if (err == ESP_ERR_NVS_NOT_FOUND) {
+    SaveImageView view;
+    if (!map_active_image(view)) {
         ESP_LOGI(TAG, "Aucun reptile sauvegardé");
         return true; // Pas d'erreur, juste aucune donnée
     }
     
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur lecture nombre reptiles: %s", esp_err_to_name(err));
-        return false;
-    }
-    
-    if (reptile_count == 0) {
-        ESP_LOGI(TAG, "Aucun reptile à charger");
-        return true;
-    }
-    
-    ESP_LOGI(TAG, "Chargement de %d reptiles", reptile_count);
+    // Copie explicite demandée par l'appelant (enregistrements intacts seulement)
+    view.copy_valid_reptiles(reptiles);
     
-    // Déterminer la taille des données
-    required_size = 0;
-    err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, nullptr, &required_size);
-    if (err != ESP_OK || required_size == 0) {
-        ESP_LOGE(TAG, "Erreur lecture taille données: %s", esp_err_to_name(err));
-        return false;
-    }
-    
-    // Allouer et charger les données
-    uint8_t* save_buffer = new uint8_t[required_size];
-    err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, save_buffer, &required_size);
-    
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur lecture données: %s", esp_err_to_name(err));
-        delete[] save_buffer;
-        return false;
-    }
-    
-    // Vérifier l'en-tête
-    if (required_size < sizeof(SaveHeader)) {
-        ESP_LOGE(TAG, "Données corrompues - taille insuffisante");
-        delete[] save_buffer;
-        return false;
-    }
-    
-    SaveHeader* header = reinterpret_cast<SaveHeader*>(save_buffer);
-    
-    if (header->version > CURRENT_SAVE_VERSION) {
-        ESP_LOGE(TAG, "Version sauvegarde non supportée: %d", header->version);
-        delete[] save_buffer;
-        return false;
-    }
-    
-    if (header->reptile_count != reptile_count) {
-        ESP_LOGW(TAG, "Incohérence nombre reptiles: %d vs %d", 
-                 header->reptile_count, reptile_count);
+    ESP_LOGI(TAG, "Reptiles chargés avec succès: %zu", reptiles.size());
+    return true;
+}
+
+bool SaveSystem::map_active_image(SaveImageView& view) {
+    // Slot indiqué par la NVS d'abord, puis l'autre slot primaire en secours
+    uint8_t candidates[2] = { active_slot, inactive_slot() };
+    for (uint8_t i = 0; i < 2; i++) {
+        if (partition.get_mapped_slot() != candidates[i]) {
+            release_mapping();
+        }
+        const uint8_t* data = partition.map_slot(candidates[i]);
+        if (data && view.open(data, SavePartition::SLOT_SIZE)) {
+            if (i > 0) {
+                ESP_LOGW(TAG, "Slot %d invalide, reprise sur le slot %d", candidates[0], candidates[i]);
+            }
+            active_slot = candidates[i];
+            save_sequence = view.header()->sequence;
+            active_image_size = view.header()->image_size;
+            return true;
+        }
     }
-    
-    // Vérifier l'intégrité des données
-    uint8_t* compressed_data = save_buffer + sizeof(SaveHeader);
-    size_t compressed_size = required_size - sizeof(SaveHeader);
-    
-    if (!verify_data_integrity(compressed_data, compressed_size, header->checksum)) {
-        ESP_LOGE(TAG, "Données corrompues - checksum invalide");
-        delete[] save_buffer;
-        return false;
+    release_mapping();
+    return false;
+}
+
+void SaveSystem::release_mapping() {
+    // Le moteur copie ses reptiles avant que la projection disparaisse
+    if (game_engine) {
+        game_engine->materialize();
     }
-    
-    // Décompresser les données
-    reptiles.clear();
-    bool success = decompress_reptile_data(compressed_data, compressed_size, reptiles);
-    
-    delete[] save_buffer;
-    
-    if (!success) {
-        ESP_LOGE(TAG, "Erreur décompression données reptiles");
+    sections.detach_all();
+    partition.unmap();
+}
+
+bool SaveSystem::register_section(PersistentSection* section) {
+    if (!sections.add(section)) {
+        ESP_LOGE(TAG, "Section %s refusée", section ? section->section_name() : "?");
         return false;
     }
-    
-    ESP_LOGI(TAG, "Reptiles chargés avec succès: %zu", reptiles.size());
     return true;
 }
 
-size_t SaveSystem::compress_reptile_data(const std::vector<Reptile>& reptiles, uint8_t* buffer, size_t buffer_size) {
-    // Compression simple - copie directe avec optimisations
-    size_t total_size = reptiles.size() * sizeof(Reptile);
-    
-    if (total_size > buffer_size) {
-        ESP_LOGE(TAG, "Buffer trop petit pour compression: %zu > %zu", total_size, buffer_size);
-        return 0;
+void SaveSystem::attach_sections(const SaveImageView& view) {
+    // Analyse unique de l'image : chaque composant reçoit une vue sur ses octets
+    for (uint8_t i = 0; i < sections.size(); i++) {
+        PersistentSection* section = sections.get(i);
+        const SaveSectionEntry* entry = view.find_section(section->section_id());
+        if (!entry) {
+            ESP_LOGI(TAG, "Section %s absente, valeurs par défaut", section->section_name());
+            continue;
+        }
+        if (!view.section_valid(*entry) ||
+            !section->attach(view.section_data(*entry), entry->size)) {
+            ESP_LOGW(TAG, "Section %s corrompue, ignorée", section->section_name());
+            statistics.dropped_sections++;
+        }
     }
-    
-    // Copier les données (compression plus sophistiquée possible ici)
-    memcpy(buffer, reptiles.data(), total_size);
-    
-    return total_size;
 }
 
-bool SaveSystem::decompress_reptile_data(const uint8_t* buffer, size_t buffer_size, std::vector<Reptile>& reptiles) {
-    // Décompression simple - copie directe
-    size_t reptile_count = buffer_size / sizeof(Reptile);
-    
-    if (reptile_count * sizeof(Reptile) != buffer_size) {
-        ESP_LOGE(TAG, "Taille données incohérente pour décompression");
+uint8_t SaveSystem::inactive_slot() const {
+    return active_slot == SavePartition::SLOT_PRIMARY_A ? SavePartition::SLOT_PRIMARY_B
+                                                         : SavePartition::SLOT_PRIMARY_A;
+}
+
+bool SaveSystem::load_legacy_reptiles(std::vector<Reptile>& reptiles) {
+    size_t required_size = 0;
+    esp_err_t err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, nullptr, &required_size);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGI(TAG, "Aucun reptile sauvegardé (v1)");
+        reptiles.clear();
+        return true;
+    }
+    if (err != ESP_OK || required_size == 0) {
+        ESP_LOGE(TAG, "Erreur lecture taille données: %s", esp_err_to_name(err));
         return false;
     }
     
-    reptiles.resize(reptile_count);
-    memcpy(reptiles.data(), buffer, buffer_size);
+    std::vector<uint8_t> blob(required_size);
+    err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, blob.data(), &required_size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Erreur lecture données: %s", esp_err_to_name(err));
+        return false;
+    }
     
-    return true;
+    return decode_legacy_save(blob.data(), required_size, reptiles);
 }
 
-uint32_t SaveSystem::calculate_checksum(const uint8_t* data, size_t size) {
-    uint32_t checksum = 0;
-    for (size_t i = 0; i < size; i++) {
-        checksum = (checksum << 1) ^ data[i];
+void SaveSystem::erase_legacy_keys() {
+    const char* legacy_keys[] = { KEY_REPTILE_COUNT, KEY_REPTILE_DATA,
+                                  KEY_REPTILE_COUNT_BACKUP, KEY_REPTILE_DATA_BACKUP };
+    for (const char* key : legacy_keys) {
+        nvs_erase_key(nvs_handle, key);
     }
-    return checksum;
-}
-
-bool SaveSystem::verify_data_integrity(const uint8_t* data, size_t size, uint32_t expected_checksum) {
-    uint32_t calculated_checksum = calculate_checksum(data, size);
-    return calculated_checksum == expected_checksum;
+    nvs_commit(nvs_handle);
 }
 
 bool SaveSystem::has_save_data() const {
@@ -394,69 +525,216 @@ uint32_t SaveSystem::get_last_save_time() const {
 }
 
 void SaveSystem::auto_save() {
-    save_game_data();
+    std::lock_guard<std::recursive_mutex> io(io_lock);
+    if (!is_initialized || !game_engine) return;
+
+    uint32_t now = esp_timer_get_time() / 1000;
+    AutosavePolicy::Decision decision = autosave_policy.evaluate(
+        now, game_engine->get_change_weight(), game_engine->get_pending_events());
+    statistics.autosave_last_decision = decision;
+
+    if (decision == AutosavePolicy::DEFER_BUDGET) {
+        statistics.autosave_deferred++;
+        return;
+    }
+    if (!AutosavePolicy::should_save(decision)) {
+        statistics.autosave_skipped++;
+        return;
+    }
+
+    ESP_LOGI(TAG, "Autosauvegarde (%s)", AutosavePolicy::decision_name(decision));
+    if (decision == AutosavePolicy::SAVE_EVENT) statistics.autosave_forced++;
+    if (game_engine->has_mapped_reptiles() && sections.dirty_count() == 0) {
+        // Image projetée inchangée : rien à écrire, l'échéance repart
+        autosave_policy.record_write(now, 0);
+        game_engine->clear_changes();
+        return;
+    }
+    if (save_game_data()) statistics.autosave_writes++;
+}
+
+void SaveSystem::update_wear_stats() {
+    uint32_t now = esp_timer_get_time() / 1000;
+    statistics.flash_erased_bytes = autosave_policy.get_lifetime_erased();
+    statistics.flash_wear_millicycles = autosave_policy.wear_millicycles();
+    statistics.daily_budget_bytes = autosave_policy.daily_budget_bytes();
+    statistics.projected_lifetime_days = autosave_policy.projected_lifetime_days(now);
+}
+
+void SaveSystem::refresh_emergency_image() {
+    if (!warm_image || !game_engine) return;
+
+    size_t count = game_engine->get_reptile_count();
+    std::lock_guard<std::recursive_mutex> io(io_lock);
+    std::lock_guard<std::mutex> lock(warm_lock);
+    // Effacements d'urgence imputés ici, sur la tâche qui tient la politique
+    if (warm_erased) {
+        autosave_policy.record_erase(esp_timer_get_time() / 1000, warm_erased);
+        warm_erased = 0;
+    }
+    warm_sequence = save_sequence;
+    if (save_image_size(count) > warm_capacity) {
+        warm_valid = false;
+        return;
+    }
+
+    // Seuls les enregistrements modifiés sont réencodés
+    if (!warm_valid || count != warm_count) warm_dirty = true;
+    for (size_t i = 0; i < count; i++) {
+        const Reptile* reptile = game_engine->peek_reptile(i);
+        uint8_t* record = warm_image + save_record_offset(i);
+        if (i >= warm_count || !warm_valid || memcmp(record, reptile, sizeof(Reptile)) != 0) {
+            encode_reptile_record(*reptile, record);
+            statistics.warm_records_updated++;
+            warm_dirty = true;
+        }
+    }
+    warm_count = count;
+    warm_valid = true;
 }
 
 void SaveSystem::emergency_save() {
     ESP_LOGW(TAG, "🚨 SAUVEGARDE D'URGENCE");
-    save_game_data();
-    nvs_commit(nvs_handle); // Force la validation immédiate
+    if (!is_initialized || !warm_image) return;
+
+    // Aucune allocation ni accès NVS : scellement de l'en-tête puis
+    // effacement + écriture d'au plus warm_capacity octets dans le slot réservé
+    uint64_t start = esp_timer_get_time();
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(warm_lock);
+        if (!warm_valid) {
+            ESP_LOGE(TAG, "Image d'urgence non préparée");
+            return;
+        }
+        // Alerte répétée chaque seconde : le slot d'urgence n'est réécrit
+        // que si l'image a changé depuis
+        if (warm_dirty) {
+            size = seal_save_image(warm_image, warm_count, warm_sequence + 1, (uint32_t)(start / 1000));
+            if (!partition.erase_slot(SavePartition::SLOT_EMERGENCY, size) ||
+                !partition.write(SavePartition::SLOT_EMERGENCY, 0, warm_image, size)) {
+                ESP_LOGE(TAG, "Échec écriture slot d'urgence");
+                return;
+            }
+            warm_dirty = false;
+            warm_erased += (size + SavePartition::SECTOR_SIZE - 1) / SavePartition::SECTOR_SIZE *
+                           SavePartition::SECTOR_SIZE;
+        }
+    }
+
+    // Comptes après l'écriture, warm_lock relâché : ordre io_lock puis warm_lock
+    // de refresh_emergency_image(), attente bornée à une sauvegarde en cours
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    std::lock_guard<std::recursive_mutex> io(io_lock);
+    if (!size) {
+        statistics.emergency_skipped++;
+        return;
+    }
+    telemetry.record_key_write(SaveTelemetry::KEY_EMERGENCY, size);
+    statistics.emergency_saves++;
+    statistics.emergency_last_us = elapsed;
+    if (elapsed > statistics.emergency_max_us) statistics.emergency_max_us = elapsed;
+    ESP_LOGW(TAG, "Sauvegarde d'urgence: %zu octets en %u us", size, (unsigned)elapsed);
+}
+
+bool SaveSystem::recover_emergency_image() {
+    release_mapping();
+    SaveImageView view;
+    const uint8_t* data = partition.map_slot(SavePartition::SLOT_EMERGENCY);
+    if (!data || !view.open(data, SavePartition::SLOT_SIZE)) {
+        partition.unmap();
+        return false;
+    }
+
+    ESP_LOGW(TAG, "Reprise de la sauvegarde d'urgence (séquence %u)", (unsigned)view.header()->sequence);
+    std::vector<Reptile> reptiles;
+    view.copy_valid_reptiles(reptiles);
+    save_sequence = view.header()->sequence;
+    partition.unmap();
+    game_engine->set_reptiles(reptiles);
+
+    // Réécriture dans un slot primaire puis libération du slot d'urgence
+    if (save_game_data()) {
+        partition.erase_slot(SavePartition::SLOT_EMERGENCY, SavePartition::SECTOR_SIZE);
+    }
+    return true;
 }
 
 void SaveSystem::clear_all_data() {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized) return;
 
     ESP_LOGW(TAG, "Suppression de toutes les données de sauvegarde");
+    release_mapping();
+    for (uint8_t slot = 0; slot < SavePartition::SLOT_COUNT; slot++) {
+        partition.erase_slot(slot, SavePartition::SECTOR_SIZE); // En-tête suffit
+    }
     nvs_erase_all(nvs_handle);
+    telemetry.reset();
+    // L'usure physique de la flash survit à l'effacement des données
+    uint64_t wear = autosave_policy.get_lifetime_erased();
+    write_key(KEY_FLASH_WEAR, &wear, sizeof(wear));
     nvs_commit(nvs_handle);
+    active_image_size = 0;
 }
 
 size_t SaveSystem::get_save_size() const {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized) return 0;
 
-    size_t total = 0;
-    size_t size = 0;
-    if (nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, nullptr, &size) == ESP_OK)
-        total += size;
-    if (nvs_get_blob(nvs_handle, KEY_REPTILE_COUNT, nullptr, &size) == ESP_OK)
-        total += size;
-    if (nvs_get_blob(nvs_handle, KEY_SAVE_VERSION, nullptr, &size) == ESP_OK)
-        total += size;
-    if (nvs_get_blob(nvs_handle, KEY_LAST_SAVE_TIME, nullptr, &size) == ESP_OK)
-        total += size;
+    // Tailles suivies à l'écriture : aucune lecture NVS supplémentaire
+    size_t total = active_image_size;
+    for (uint8_t i = 0; i < telemetry.get_key_count(); i++) {
+        const SaveTelemetry::KeyBytes& key = telemetry.get_key(i);
+        if (key.key[0] != '<') total += key.last_size; // Pseudo-clés partition exclues
+    }
     return total;
 }
 
-bool SaveSystem::backup_save() {
-    if (!is_initialized) return false;
+esp_err_t SaveSystem::write_key(const char* key, const void* data, size_t size) {
+    esp_err_t err = nvs_set_blob(nvs_handle, key, data, size);
+    if (err == ESP_OK) telemetry.record_key_write(key, size);
+    return err;
+}
 
-    size_t size = 0;
-    esp_err_t err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, nullptr, &size);
-    if (err != ESP_OK) return false;
-    std::vector<uint8_t> buffer(size);
-    err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA, buffer.data(), &size);
-    if (err != ESP_OK) return false;
-    err = nvs_set_blob(nvs_handle, KEY_REPTILE_DATA_BACKUP, buffer.data(), size);
-    if (err != ESP_OK) return false;
+void SaveSystem::log_io_report() {
+    // Tâche de surveillance (cœur 0) : histogrammes lus et remis à zéro, usure
+    // recalculée et statistiques copiées sous io_lock, hors de toute sauvegarde
+    SaveStats snapshot;
+    {
+        std::lock_guard<std::recursive_mutex> io(io_lock);
+        telemetry.refresh_nvs_usage();
+        telemetry.log_report();
+        update_wear_stats();
+        snapshot = statistics;
+    }
+    ESP_LOGI(TAG, "Usure flash: %llu octets effacés (%u.%03u cycles/secteur), durée de vie projetée %u jours",
+             (unsigned long long)snapshot.flash_erased_bytes,
+             (unsigned)(snapshot.flash_wear_millicycles / 1000),
+             (unsigned)(snapshot.flash_wear_millicycles % 1000),
+             (unsigned)snapshot.projected_lifetime_days);
+}
 
-    uint16_t count = 0;
-    size = sizeof(count);
-    if (nvs_get_blob(nvs_handle, KEY_REPTILE_COUNT, &count, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_REPTILE_COUNT_BACKUP, &count, sizeof(count));
-        if (err != ESP_OK) return false;
+bool SaveSystem::backup_save() {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
+    if (!is_initialized || active_image_size == 0) return false;
+
+    if (!partition.copy_slot(active_slot, SavePartition::SLOT_BACKUP, active_image_size)) {
+        ESP_LOGE(TAG, "Erreur copie slot de secours");
+        return false;
     }
 
     uint32_t version = 0;
-    size = sizeof(version);
+    size_t size = sizeof(version);
     if (nvs_get_blob(nvs_handle, KEY_SAVE_VERSION, &version, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION_BACKUP, &version, sizeof(version));
+        esp_err_t err = write_key(KEY_SAVE_VERSION_BACKUP, &version, sizeof(version));
         if (err != ESP_OK) return false;
     }
 
     uint32_t ts = 0;
     size = sizeof(ts);
     if (nvs_get_blob(nvs_handle, KEY_LAST_SAVE_TIME, &ts, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_LAST_SAVE_TIME_BACKUP, &ts, sizeof(ts));
+        esp_err_t err = write_key(KEY_LAST_SAVE_TIME_BACKUP, &ts, sizeof(ts));
         if (err != ESP_OK) return false;
     }
 
@@ -464,41 +742,47 @@ bool SaveSystem::backup_save() {
 }
 
 bool SaveSystem::restore_backup() {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     if (!is_initialized) return false;
 
-    size_t size = 0;
-    esp_err_t err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA_BACKUP, nullptr, &size);
-    if (err != ESP_OK) return false;
-    std::vector<uint8_t> buffer(size);
-    err = nvs_get_blob(nvs_handle, KEY_REPTILE_DATA_BACKUP, buffer.data(), &size);
-    if (err != ESP_OK) return false;
-    err = nvs_set_blob(nvs_handle, KEY_REPTILE_DATA, buffer.data(), size);
-    if (err != ESP_OK) return false;
+    SaveImageHeader header;
+    if (!partition.read(SavePartition::SLOT_BACKUP, 0, &header, sizeof(header)) ||
+        header.magic != SAVE_IMAGE_MAGIC || header.image_size > SavePartition::SLOT_SIZE) {
+        ESP_LOGE(TAG, "Aucune image de secours valide");
+        return false;
+    }
 
-    uint16_t count = 0;
-    size = sizeof(count);
-    if (nvs_get_blob(nvs_handle, KEY_REPTILE_COUNT_BACKUP, &count, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_REPTILE_COUNT, &count, sizeof(count));
-        if (err != ESP_OK) return false;
+    // La copie va dans le slot inactif puis devient le slot actif
+    uint8_t target = inactive_slot();
+    if (partition.get_mapped_slot() == target) {
+        release_mapping();
     }
+    if (!partition.copy_slot(SavePartition::SLOT_BACKUP, target, header.image_size)) return false;
+    esp_err_t err = write_key(KEY_ACTIVE_SLOT, &target, sizeof(target));
+    if (err != ESP_OK) return false;
 
     uint32_t version = 0;
-    size = sizeof(version);
+    size_t size = sizeof(version);
     if (nvs_get_blob(nvs_handle, KEY_SAVE_VERSION_BACKUP, &version, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_SAVE_VERSION, &version, sizeof(version));
+        err = write_key(KEY_SAVE_VERSION, &version, sizeof(version));
         if (err != ESP_OK) return false;
     }
 
     uint32_t ts = 0;
     size = sizeof(ts);
     if (nvs_get_blob(nvs_handle, KEY_LAST_SAVE_TIME_BACKUP, &ts, &size) == ESP_OK) {
-        err = nvs_set_blob(nvs_handle, KEY_LAST_SAVE_TIME, &ts, sizeof(ts));
+        err = write_key(KEY_LAST_SAVE_TIME, &ts, sizeof(ts));
         if (err != ESP_OK) return false;
     }
 
-    return nvs_commit(nvs_handle) == ESP_OK;
+    if (nvs_commit(nvs_handle) != ESP_OK) return false;
+    active_slot = target;
+    active_image_size = header.image_size;
+    save_sequence = header.sequence;
+    return true;
 }
 
 SaveSystem::SaveStats SaveSystem::get_save_statistics() const {
+    std::lock_guard<std::recursive_mutex> io(io_lock);
     return statistics;
 }
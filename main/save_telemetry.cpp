@@ -0,0 +1,114 @@
+#include "include/save_telemetry.h"
+#include "esp_log.h"
+#include <cstring>
+
+static const char* TAG = "SaveTelemetry";
+
+void LogHistogram::record(uint32_t value_us) {
+    uint8_t index = 0;
+    while (index < BUCKET_COUNT - 1 && value_us > bucket_limit(index)) {
+        index++;
+    }
+    buckets[index]++;
+    samples++;
+    total += value_us;
+    if (value_us > max_value) max_value = value_us;
+}
+
+void LogHistogram::reset() {
+    *this = LogHistogram();
+}
+
+uint32_t LogHistogram::bucket_limit(uint8_t index) {
+    return index >= 31 ? UINT32_MAX : (1u << index);
+}
+
+uint32_t LogHistogram::percentile(uint8_t pct) const {
+    if (samples == 0) return 0;
+    uint32_t rank = (uint64_t)samples * pct / 100;
+    if (rank == 0) rank = 1;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // Le dernier seau est ouvert : le maximum observé est plus juste
+            uint32_t limit = i == BUCKET_COUNT - 1 ? max_value : bucket_limit(i);
+            return limit < max_value ? limit : max_value;
+        }
+    }
+    return max_value;
+}
+
+const char* SaveTelemetry::phase_name(SavePhase p) {
+    switch (p) {
+        case SAVE_PHASE_SNAPSHOT: return "instantané";
+        case SAVE_PHASE_ENCODE: return "encodage";
+        case SAVE_PHASE_WRITE: return "écriture";
+        case SAVE_PHASE_COMMIT: return "commit";
+        default: return "?";
+    }
+}
+
+void SaveTelemetry::record_phase(SavePhase phase, uint32_t duration_us) {
+    if (phase < SAVE_PHASE_COUNT) phases[phase].record(duration_us);
+}
+
+void SaveTelemetry::record_key_write(const char* key, size_t bytes) {
+    KeyBytes* entry = const_cast<KeyBytes*>(find_key(key));
+    if (!entry) {
+        if (key_count >= MAX_KEYS) return;
+        entry = &keys[key_count++];
+        entry->key = key;
+    }
+    entry->writes++;
+    entry->bytes += bytes;
+    entry->last_size = bytes;
+}
+
+const SaveTelemetry::KeyBytes* SaveTelemetry::find_key(const char* key) const {
+    for (uint8_t i = 0; i < key_count; i++) {
+        if (keys[i].key == key || strcmp(keys[i].key, key) == 0) return &keys[i];
+    }
+    return nullptr;
+}
+
+size_t SaveTelemetry::current_size() const {
+    size_t size = 0;
+    for (uint8_t i = 0; i < key_count; i++) size += keys[i].last_size;
+    return size;
+}
+
+uint64_t SaveTelemetry::total_bytes() const {
+    uint64_t bytes = 0;
+    for (uint8_t i = 0; i < key_count; i++) bytes += keys[i].bytes;
+    return bytes;
+}
+
+bool SaveTelemetry::refresh_nvs_usage(const char* partition_label) {
+    nvs_usage_valid = nvs_get_stats(partition_label, &nvs_usage) == ESP_OK;
+    return nvs_usage_valid;
+}
+
+void SaveTelemetry::reset() {
+    *this = SaveTelemetry();
+}
+
+void SaveTelemetry::log_report() const {
+    ESP_LOGI(TAG, "=== E/S SAUVEGARDE ===");
+    for (uint8_t p = 0; p < SAVE_PHASE_COUNT; p++) {
+        const LogHistogram& h = phases[p];
+        ESP_LOGI(TAG, "%-10s n=%u moy=%u us p50=%u p90=%u p99=%u max=%u",
+                 phase_name((SavePhase)p), (unsigned)h.count(), (unsigned)h.mean(),
+                 (unsigned)h.percentile(50), (unsigned)h.percentile(90),
+                 (unsigned)h.percentile(99), (unsigned)h.max());
+    }
+    for (uint8_t i = 0; i < key_count; i++) {
+        ESP_LOGI(TAG, "clé %-12s %u écritures, %llu octets", keys[i].key,
+                 (unsigned)keys[i].writes, (unsigned long long)keys[i].bytes);
+    }
+    if (nvs_usage_valid) {
+        ESP_LOGI(TAG, "NVS: %u/%u entrées utilisées, %u espaces de noms",
+                 (unsigned)nvs_usage.used_entries, (unsigned)nvs_usage.total_entries,
+                 (unsigned)nvs_usage.namespace_count);
+    }
+}
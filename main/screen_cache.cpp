@@ -0,0 +1,61 @@
+#include "include/screen_cache.h"
+
+ScreenCache::ScreenCache(uint8_t screen_count, uint32_t budget_bytes)
+    : count(screen_count > MAX_SCREENS ? MAX_SCREENS : screen_count), budget(budget_bytes) {
+}
+
+void ScreenCache::pin(uint8_t id) {
+    if (id < count) entries[id].pinned = true;
+}
+
+void ScreenCache::touch(uint8_t id) {
+    if (id < count) entries[id].last_used = ++clock;
+}
+
+void ScreenCache::record_build(uint8_t id, uint32_t bytes, uint32_t build_us) {
+    if (id >= count) return;
+    Entry& e = entries[id];
+    e.built = true;
+    e.bytes = bytes;
+    e.build_us_last = build_us;
+    if (build_us > e.build_us_max) e.build_us_max = build_us;
+    e.builds++;
+    e.last_used = ++clock;
+}
+
+void ScreenCache::record_eviction(uint8_t id) {
+    if (id >= count || !entries[id].built) return;
+    // L'empreinte est conservée comme estimation pour la prochaine construction
+    entries[id].built = false;
+    entries[id].evictions++;
+}
+
+int8_t ScreenCache::next_victim(uint8_t incoming, uint8_t current) const {
+    uint32_t needed = resident_bytes();
+    if (incoming < count && !entries[incoming].built) needed += entries[incoming].bytes;
+    if (needed <= budget) return NONE;
+
+    int8_t victim = NONE;
+    for (uint8_t i = 0; i < count; i++) {
+        const Entry& e = entries[i];
+        if (!e.built || e.pinned || i == incoming || i == current) continue;
+        if (victim == NONE || e.last_used < entries[victim].last_used) victim = (int8_t)i;
+    }
+    return victim;
+}
+
+uint32_t ScreenCache::resident_bytes() const {
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (entries[i].built) bytes += entries[i].bytes;
+    }
+    return bytes;
+}
+
+uint8_t ScreenCache::resident_count() const {
+    uint8_t resident = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (entries[i].built) resident++;
+    }
+    return resident;
+}
@@ -0,0 +1,99 @@
+#include "include/touch_input.h"
+#include <math.h>
+#include <stdlib.h>
+
+bool ft5x06_parse(const uint8_t* regs, uint32_t irq_us, TouchSample& sample) {
+    uint8_t count = regs[0] & 0x0F;
+    if (count > FT5X06_MAX_POINTS) return false;    // 0x0F : registres pas encore prêts
+
+    sample.irq_us = irq_us;
+    sample.count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        const uint8_t* p = regs + 1 + i * FT5X06_POINT_BYTES;
+        sample.points[i].x = (uint16_t)(((p[0] & 0x0F) << 8) | p[1]);
+        sample.points[i].y = (uint16_t)(((p[2] & 0x0F) << 8) | p[3]);
+        sample.points[i].id = p[2] >> 4;
+    }
+    return true;
+}
+
+bool TouchRing::push(const TouchSample& sample) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    bool kept = true;
+    // Pleine : écarte le plus ancien. Si le CAS échoue, le consommateur vient
+    // de libérer une case et rien n'est perdu.
+    if (h - t >= CAPACITY) {
+        kept = !tail.compare_exchange_strong(t, t + 1, std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+    samples[h & (CAPACITY - 1)] = sample;
+    head.store(h + 1, std::memory_order_release);
+    return kept;
+}
+
+bool TouchRing::pop(TouchSample& sample) {
+    uint32_t t = tail.load(std::memory_order_acquire);
+    while (t != head.load(std::memory_order_acquire)) {
+        sample = samples[t & (CAPACITY - 1)];
+        // Échec : le producteur a écarté cette case, `t` est rechargé
+        if (tail.compare_exchange_weak(t, t + 1, std::memory_order_acq_rel, std::memory_order_acquire)) return true;
+    }
+    return false;
+}
+
+static float spread(const TouchSample& sample) {
+    float dx = (float)sample.points[0].x - (float)sample.points[1].x;
+    float dy = (float)sample.points[0].y - (float)sample.points[1].y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+bool GestureDetector::feed(const TouchSample& sample, TouchGesture& gesture) {
+    if (sample.count == 0) {
+        if (!tracking) return false;
+        tracking = false;
+        if (multi) return false;
+
+        // Levée du doigt : balayage si le déplacement est ample, rapide et franc
+        int32_t dx = (int32_t)last.x - start.x;
+        int32_t dy = (int32_t)last.y - start.y;
+        if (sample.irq_us - start_us > SWIPE_MAX_US) return false;
+        gesture.start_x = start.x;
+        gesture.start_y = start.y;
+        gesture.scale_permille = 1000;
+        if (abs(dx) >= SWIPE_MIN_PX && abs(dx) > 2 * abs(dy)) {
+            gesture.type = dx < 0 ? GestureType::SWIPE_LEFT : GestureType::SWIPE_RIGHT;
+            return true;
+        }
+        if (abs(dy) >= SWIPE_MIN_PX && abs(dy) > 2 * abs(dx)) {
+            gesture.type = dy < 0 ? GestureType::SWIPE_UP : GestureType::SWIPE_DOWN;
+            return true;
+        }
+        return false;
+    }
+
+    if (!tracking) {
+        tracking = true;
+        multi = false;
+        start_us = sample.irq_us;
+        start = sample.points[0];
+        pinch_base = 0.0f;
+    }
+    last = sample.points[0];
+    if (sample.count < 2) return false;
+
+    // Deux doigts : pincement par paliers, relatif au dernier palier émis
+    float distance = spread(sample);
+    if (!multi || pinch_base < 1.0f) {
+        multi = true;
+        pinch_base = distance;
+        return false;
+    }
+    float scale = distance / pinch_base;
+    if (fabsf(scale - 1.0f) * 1000.0f < PINCH_STEP) return false;
+    pinch_base = distance;
+    gesture.type = GestureType::PINCH;
+    gesture.start_x = (uint16_t)((sample.points[0].x + sample.points[1].x) / 2);
+    gesture.start_y = (uint16_t)((sample.points[0].y + sample.points[1].y) / 2);
+    gesture.scale_permille = (uint16_t)fminf(scale * 1000.0f, 65535.0f);
+    return true;
+}
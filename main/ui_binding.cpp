@@ -0,0 +1,106 @@
+#include "include/ui_binding.h"
+#include <cmath>
+#include <cstdio>
+
+int8_t UIBindings::add(lv_obj_t* widget, BindingKind kind, const char* format, float step) {
+    if (!widget || count >= MAX_BINDINGS) return INVALID;
+    Binding& binding = bindings[count];
+    binding.widget = widget;
+    binding.kind = kind;
+    binding.format = format;
+    binding.step = step > 0.0f ? step : 1.0f;
+    binding.shown = 0;
+    binding.valid = false;
+    return (int8_t)count++;
+}
+
+int8_t UIBindings::bind_label(lv_obj_t* label, const char* format, float step) {
+    return add(label, BindingKind::LABEL, format, step);
+}
+
+int8_t UIBindings::bind_slider(lv_obj_t* slider, float step) {
+    return add(slider, BindingKind::SLIDER, nullptr, step);
+}
+
+int8_t UIBindings::bind_bar(lv_obj_t* bar, float step) {
+    return add(bar, BindingKind::BAR, nullptr, step);
+}
+
+int8_t UIBindings::bind_text(lv_obj_t* label) {
+    return add(label, BindingKind::TEXT, nullptr, 1.0f);
+}
+
+void UIBindings::apply(Binding& binding) {
+    int32_t value = (int32_t)lroundf(binding.shown * binding.step);
+    switch (binding.kind) {
+        case BindingKind::LABEL: {
+            char buf[64];
+            snprintf(buf, sizeof(buf), binding.format, value);
+            lv_label_set_text(binding.widget, buf);
+            break;
+        }
+        case BindingKind::SLIDER:
+            lv_slider_set_value(binding.widget, value, LV_ANIM_OFF);
+            break;
+        case BindingKind::BAR:
+            lv_bar_set_value(binding.widget, value, LV_ANIM_ON);
+            break;
+        case BindingKind::TEXT:
+            lv_label_set_text(binding.widget, binding.format);
+            break;
+    }
+    binding.valid = true;
+    stats.widget_updates++;
+}
+
+bool UIBindings::set(int8_t id, float value) {
+    if (id < 0 || id >= count) return false;
+    Binding& binding = bindings[id];
+    if (binding.kind == BindingKind::TEXT) return false;
+
+    float steps = value / binding.step;
+    int32_t quantized = (int32_t)lroundf(steps);
+    if (binding.valid) {
+        if (quantized == binding.shown ||
+            fabsf(steps - (float)binding.shown) < 0.5f + HYSTERESIS) {
+            stats.skipped++;
+            return false;
+        }
+    }
+    binding.shown = quantized;
+    apply(binding);
+    return true;
+}
+
+bool UIBindings::set_text(int8_t id, const char* text) {
+    if (id < 0 || id >= count || !text) return false;
+    Binding& binding = bindings[id];
+    if (binding.kind != BindingKind::TEXT) return false;
+
+    // Chaînes constantes : la comparaison de pointeurs suffit
+    if (binding.valid && binding.format == text) {
+        stats.skipped++;
+        return false;
+    }
+    binding.format = text;
+    apply(binding);
+    return true;
+}
+
+void UIBindings::invalidate(int8_t id) {
+    if (id >= 0 && id < count) bindings[id].valid = false;
+}
+
+void UIBindings::invalidate_all() {
+    for (uint8_t i = 0; i < count; i++) bindings[i].valid = false;
+}
+
+void UIBindings::clear() {
+    count = 0;
+    stats = {};
+}
+
+float UIBindings::displayed(int8_t id) const {
+    if (id < 0 || id >= count || !bindings[id].valid) return 0.0f;
+    return bindings[id].shown * bindings[id].step;
+}
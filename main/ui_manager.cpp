@@ -1,13 +1,37 @@
 #include <inttypes.h>
+#include <cstring>
 #include "include/ui_manager.h"
 #include "include/species_database.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 static const char* TAG = "UIManager";
 
+// Octets tenus par l'allocateur de LVGL (lv_mem_esp.c sur cible, TLSF intégré
+// sur hôte) : les allocations des autres tâches n'entrent pas dans l'empreinte
+static size_t lvgl_used_bytes() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
 UIManager::UIManager(GameEngine* engine)
-    : game_engine(engine), current_screen(SCREEN_MAIN), notification_visible(false) {
+    : game_engine(engine), notification_area(nullptr),
+      current_screen(SCREEN_MAIN), screen_cache(screen_count, DEFAULT_SCREEN_BUDGET),
+      reptile_list(engine, on_reptile_selected, this),
+      notification_timer(nullptr) {
     last_ui_update = 0;
+    for (uint8_t i = 0; i < NotificationCenter::SLOT_COUNT; ++i) {
+        toasts[i] = nullptr;
+        toast_labels[i] = nullptr;
+    }
+    bind_temp_label = bind_temp_slider = UIBindings::INVALID;
+    bind_hum_label = bind_hum_slider = UIBindings::INVALID;
+    bind_behavior = UIBindings::INVALID;
+    bind_last_feeding = UIBindings::INVALID;
+    for (uint8_t i = 0; i < MainScreenView::HEALTH_BAR_COUNT; ++i) {
+        bind_health[i] = UIBindings::INVALID;
+    }
     for (uint8_t i = 0; i < screen_count; ++i) {
         screens[i] = nullptr;
     }
@@ -33,6 +57,7 @@ bool UIManager::initialize() {
     lv_style_set_shadow_width(&style_card, 8);
     lv_style_set_shadow_color(&style_card, lv_color_hex(0x000000));
     lv_style_set_shadow_opa(&style_card, LV_OPA_30);
+    card_layers.set_style({0x3B4252, 12, 8, LV_OPA_30, 0x000000});
     
     lv_style_init(&style_btn_primary);
     lv_style_set_bg_color(&style_btn_primary, lv_color_hex(0x5E81AC));
@@ -55,8 +80,26 @@ bool UIManager::initialize() {
     lv_style_init(&style_health_critical);
     lv_style_set_bg_color(&style_health_critical, lv_color_hex(0xBF616A));
     
-    // Création de l'écran principal
+    // Création de l'écran principal (seul écran construit au démarrage)
+    int64_t build_start = esp_timer_get_time();
+    size_t lvgl_before = lvgl_used_bytes();
     create_main_screen();
+    size_t lvgl_after = lvgl_used_bytes();
+    screen_cache.record_build(SCREEN_MAIN, lvgl_after > lvgl_before ? lvgl_after - lvgl_before : 0,
+                              (uint32_t)(esp_timer_get_time() - build_start));
+    screen_cache.pin(SCREEN_MAIN);
+
+    // Une vue incomplète signale une construction modifiée sans mise à jour des poignées
+    const char* missing = main_view.first_missing();
+    if (missing) {
+        ESP_LOGE(TAG, "Widget non enregistré dans la vue principale: %s", missing);
+        return false;
+    }
+    bind_main_view();
+
+    if (!vitals_chart.init()) {
+        ESP_LOGW(TAG, "Historique des constantes indisponible (mémoire)");
+    }
     
     ESP_LOGI(TAG, "Interface utilisateur initialisée avec succès");
     return true;
@@ -72,9 +115,11 @@ void UIManager::create_main_screen() {
     lv_obj_add_style(reptile_info_panel, &style_card, 0);
     lv_obj_set_size(reptile_info_panel, 480, 200);
     lv_obj_set_pos(reptile_info_panel, 20, 20);
+    card_layers.attach(reptile_info_panel);
     
     // Nom et espèce du reptile
     lv_obj_t* name_label = lv_label_create(reptile_info_panel);
+    main_view.name_label = name_label;
     lv_label_set_text(name_label, "Sélectionnez un reptile");
     lv_obj_set_style_text_font(name_label, &lv_font_montserrat_24, 0);
     lv_obj_set_style_text_color(name_label, lv_color_hex(0xECEFF4), 0);
@@ -89,9 +134,17 @@ void UIManager::create_main_screen() {
     
     // Informations vitales compactes
     lv_obj_t* vital_info = lv_label_create(reptile_info_panel);
+    main_view.vital_info = vital_info;
     lv_label_set_text(vital_info, "Âge: -- jours\nPoids: -- g\nTaille: -- mm");
     lv_obj_set_style_text_color(vital_info, lv_color_hex(0xD8DEE9), 0);
     lv_obj_set_pos(vital_info, 0, 50);
+
+    // Comportement courant
+    lv_obj_t* behavior_label = lv_label_create(reptile_info_panel);
+    main_view.behavior_label = behavior_label;
+    lv_label_set_text(behavior_label, "❓");
+    lv_obj_set_style_text_color(behavior_label, lv_color_hex(0xEBCB8B), 0);
+    lv_obj_set_pos(behavior_label, 0, 130);
     
     // Barres de santé
     create_health_monitoring();
@@ -109,12 +162,7 @@ void UIManager::create_main_screen() {
     create_navigation_menu();
     
     // Zone de notifications
-    notification_area = lv_obj_create(main_screen);
-    lv_obj_set_size(notification_area, 600, 60);
-    lv_obj_set_pos(notification_area, 200, 10);
-    lv_obj_add_flag(notification_area, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_style_bg_color(notification_area, lv_color_hex(0xEBCB8B), 0);
-    lv_obj_set_style_radius(notification_area, 8, 0);
+    create_notification_toasts();
     
     lv_scr_load(main_screen);
 }
@@ -124,6 +172,7 @@ void UIManager::create_health_monitoring() {
     lv_obj_add_style(health_bars, &style_card, 0);
     lv_obj_set_size(health_bars, 280, 180);
     lv_obj_set_pos(health_bars, 520, 20);
+    card_layers.attach(health_bars);
     
     // Titre
     lv_obj_t* title = lv_label_create(health_bars);
@@ -134,7 +183,7 @@ void UIManager::create_health_monitoring() {
     // Barres de santé avec icônes
     const char* health_labels[] = {"Santé", "Faim", "Hydratation", "Stress"};
     
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < MainScreenView::HEALTH_BAR_COUNT; i++) {
         // Label
         lv_obj_t* label = lv_label_create(health_bars);
         lv_label_set_text(label, health_labels[i]);
@@ -146,6 +195,7 @@ void UIManager::create_health_monitoring() {
         lv_obj_set_size(bar, 150, 20);
         lv_obj_set_pos(bar, 100, 30 + i * 35);
         lv_bar_set_value(bar, 75, LV_ANIM_ON); // Valeur par défaut
+        main_view.health_bars[i] = bar;
         
         // Couleur dynamique selon la valeur
         if (i == 3) { // Stress - inversé (rouge = mauvais)
@@ -161,6 +211,7 @@ void UIManager::create_environment_controls() {
     lv_obj_add_style(environment_controls, &style_card, 0);
     lv_obj_set_size(environment_controls, 380, 120);
     lv_obj_set_pos(environment_controls, 20, 240);
+    card_layers.attach(environment_controls);
     
     lv_obj_t* title = lv_label_create(environment_controls);
     lv_label_set_text(title, "Contrôles environnementaux");
@@ -174,10 +225,12 @@ void UIManager::create_environment_controls() {
     lv_obj_clear_flag(temp_container, LV_OBJ_FLAG_SCROLLABLE);
     
     lv_obj_t* temp_label = lv_label_create(temp_container);
+    main_view.temp_label = temp_label;
     lv_label_set_text(temp_label, "🌡️ Température: 30°C");
     lv_obj_set_style_text_color(temp_label, lv_color_hex(0xD8DEE9), 0);
     
     lv_obj_t* temp_slider = lv_slider_create(temp_container);
+    main_view.temp_slider = temp_slider;
     lv_obj_set_size(temp_slider, 150, 20);
     lv_obj_set_pos(temp_slider, 0, 25);
     lv_slider_set_range(temp_slider, 18, 45);
@@ -191,10 +244,12 @@ void UIManager::create_environment_controls() {
     lv_obj_clear_flag(hum_container, LV_OBJ_FLAG_SCROLLABLE);
     
     lv_obj_t* hum_label = lv_label_create(hum_container);
+    main_view.hum_label = hum_label;
     lv_label_set_text(hum_label, "💧 Humidité: 60%");
     lv_obj_set_style_text_color(hum_label, lv_color_hex(0xD8DEE9), 0);
     
     lv_obj_t* hum_slider = lv_slider_create(hum_container);
+    main_view.hum_slider = hum_slider;
     lv_obj_set_size(hum_slider, 150, 20);
     lv_obj_set_pos(hum_slider, 0, 25);
     lv_slider_set_range(hum_slider, 20, 90);
@@ -207,6 +262,7 @@ void UIManager::create_feeding_interface() {
     lv_obj_add_style(feeding_panel, &style_card, 0);
     lv_obj_set_size(feeding_panel, 420, 120);
     lv_obj_set_pos(feeding_panel, 420, 240);
+    card_layers.attach(feeding_panel);
     
     lv_obj_t* title = lv_label_create(feeding_panel);
     lv_label_set_text(title, "🍽️ Alimentation");
@@ -234,7 +290,8 @@ void UIManager::create_feeding_interface() {
     
     // Indicateur de dernière alimentation
     lv_obj_t* last_feeding = lv_label_create(feeding_panel);
-    lv_label_set_text(last_feeding, "Dernière alimentation: il y a 2h");
+    main_view.last_feeding_label = last_feeding;
+    lv_label_set_text(last_feeding, "Dernière alimentation: il y a -- h");
     lv_obj_set_pos(last_feeding, 200, 30);
     lv_obj_set_style_text_color(last_feeding, lv_color_hex(0xD8DEE9), 0);
     lv_obj_set_style_text_font(last_feeding, &lv_font_montserrat_12, 0);
@@ -243,7 +300,7 @@ void UIManager::create_feeding_interface() {
 void UIManager::create_care_buttons() {
     // Boutons de soins rapides en bas de l'écran
     const char* care_labels[] = {"🧹 Nettoyer", "💡 Éclairage", "🏥 Santé", "👥 Reproduction"};
-    lv_event_cb_t callbacks[] = {on_clean_terrarium, on_lighting_toggle, on_health_check, nullptr};
+    lv_event_cb_t callbacks[] = {on_clean_terrarium, on_lighting_toggle, on_health_check, on_breeding_open};
     
     for (int i = 0; i < 4; i++) {
         lv_obj_t* care_btn = lv_btn_create(main_screen);
@@ -270,6 +327,7 @@ void UIManager::create_navigation_menu() {
     lv_obj_set_style_border_width(nav_menu, 0, 0);
     
     const char* nav_labels[] = {"🏠 Accueil", "🦎 Reptiles", "⚙️ Habitat", "📊 Stats", "⚙️ Paramètres"};
+    const uint8_t nav_targets[] = {SCREEN_MAIN, SCREEN_REPTILE_SELECT, SCREEN_HABITAT, SCREEN_STATS, SCREEN_SETTINGS};
     
     for (int i = 0; i < 5; i++) {
         lv_obj_t* nav_btn = lv_btn_create(nav_menu);
@@ -283,18 +341,64 @@ void UIManager::create_navigation_menu() {
         lv_obj_center(nav_label);
         lv_obj_set_style_text_color(nav_label, lv_color_hex(0xECEFF4), 0);
         
-        lv_obj_set_user_data(nav_btn, (void*)(intptr_t)i);
+        lv_obj_set_user_data(nav_btn, (void*)(intptr_t)nav_targets[i]);
         lv_obj_add_event_cb(nav_btn, on_navigation_click, LV_EVENT_CLICKED, this);
     }
 }
 
+void UIManager::bind_main_view() {
+    bindings.clear();
+    bind_temp_label = bindings.bind_label(main_view.temp_label, "🌡️ Température: %" PRId32 "°C");
+    bind_temp_slider = bindings.bind_slider(main_view.temp_slider);
+    bind_hum_label = bindings.bind_label(main_view.hum_label, "💧 Humidité: %" PRId32 "%%");
+    bind_hum_slider = bindings.bind_slider(main_view.hum_slider);
+    for (uint8_t i = 0; i < MainScreenView::HEALTH_BAR_COUNT; i++) {
+        bind_health[i] = bindings.bind_bar(main_view.health_bars[i]);
+    }
+    bind_behavior = bindings.bind_text(main_view.behavior_label);
+    bind_last_feeding = bindings.bind_label(main_view.last_feeding_label,
+                                            "Dernière alimentation: il y a %" PRId32 " h");
+}
+
+void UIManager::create_notification_toasts() {
+    // Calque supérieur : les toasts restent visibles quel que soit l'écran
+    notification_area = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(notification_area, 600, NotificationCenter::SLOT_COUNT * 56);
+    lv_obj_set_pos(notification_area, 200, 10);
+    lv_obj_set_style_bg_opa(notification_area, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(notification_area, 0, 0);
+    lv_obj_set_style_pad_all(notification_area, 0, 0);
+    lv_obj_clear_flag(notification_area, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(notification_area, LV_OBJ_FLAG_CLICKABLE);
+
+    // Pool fixe : aucun widget créé ni détruit après l'initialisation
+    for (uint8_t i = 0; i < NotificationCenter::SLOT_COUNT; i++) {
+        toasts[i] = lv_obj_create(notification_area);
+        lv_obj_set_size(toasts[i], 600, 50);
+        lv_obj_set_pos(toasts[i], 0, i * 56);
+        lv_obj_set_style_radius(toasts[i], 8, 0);
+        lv_obj_set_style_border_width(toasts[i], 0, 0);
+        lv_obj_clear_flag(toasts[i], LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(toasts[i], LV_OBJ_FLAG_HIDDEN);
+
+        toast_labels[i] = lv_label_create(toasts[i]);
+        lv_label_set_text(toast_labels[i], "");
+        lv_obj_set_style_text_color(toast_labels[i], lv_color_hex(0x2E3440), 0);
+        lv_obj_center(toast_labels[i]);
+    }
+
+    // Minuterie unique, en pause tant qu'aucun toast n'est visible ou en attente
+    notification_timer = lv_timer_create(on_notification_timer, 100, this);
+    lv_timer_pause(notification_timer);
+}
+
 // Callbacks d'événements
 void UIManager::on_feed_button(lv_event_t* e) {
     UIManager* ui = static_cast<UIManager*>(lv_event_get_user_data(e));
     lv_obj_t* btn = static_cast<lv_obj_t*>(lv_event_get_target(e));
     FoodType food = static_cast<FoodType>((intptr_t)lv_obj_get_user_data(btn));
     
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->feed_reptile(selected, food)) {
         ui->show_notification("✅ Alimentation réussie!", false);
         ui->animate_feeding(btn);
@@ -308,25 +412,39 @@ void UIManager::on_temperature_adjust(lv_event_t* e) {
     lv_obj_t* slider = static_cast<lv_obj_t*>(lv_event_get_target(e));
     int32_t value = lv_slider_get_value(slider);
     
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    // Le curseur a bougé hors liaison : resynchronisation si l'ajustement est refusé
+    ui->bindings.invalidate(ui->bind_temp_slider);
+
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->adjust_temperature(selected, (float)value)) {
         char msg[64];
         snprintf(msg, sizeof(msg), "🌡️ Température: %" PRId32 "°C", value);
-        ui->show_notification(msg, false);
+        ui->notify(NotificationCenter::make_key("température"), msg, NOTIF_INFO);
     }
 }
 
 void UIManager::update() {
+    // Liste des reptiles : rafraîchissement borné aux lignes visibles
+    if (current_screen == SCREEN_REPTILE_SELECT) {
+        reptile_list.update(lv_tick_get());
+    }
+
     if (game_engine->get_reptile_count() == 0) return;
     
-    uint8_t selected = game_engine->get_selected_reptile();
-    Reptile* reptile = game_engine->get_reptile(selected);
+    // Lecture seule : n'entraîne pas la copie de l'image de sauvegarde
+    uint16_t selected = game_engine->get_selected_reptile();
+    const Reptile* reptile = game_engine->peek_reptile(selected);
     if (!reptile) return;
+
+    // Historique alimenté en continu ; le graphique n'est tenu à jour qu'affiché
+    vitals_chart.sample(selected, reptile->habitat.temperature_day, reptile->habitat.humidity, lv_tick_get());
+    if (current_screen == SCREEN_STATS) vitals_chart.update();
     
     // Mise à jour des informations vitales
     update_health_display(*reptile);
     update_environment_display(*reptile);
     update_behavior_animation(*reptile);
+    update_vitals_display(*reptile);
     
     // Vérifications d'alertes
     if (reptile->health.hunger_level > 80) {
@@ -339,37 +457,71 @@ void UIManager::update() {
 }
 
 void UIManager::update_health_display(const Reptile& reptile) {
-    // Mise à jour des barres de santé avec animations fluides
-    // Implémentation détaillée des animations et couleurs dynamiques
+    // Barres animées par LVGL, relancées seulement quand le pourcentage change
+    bindings.set(bind_health[0], reptile.health.overall_health);
+    bindings.set(bind_health[1], reptile.health.hunger_level);
+    bindings.set(bind_health[2], reptile.health.hydration);
+    bindings.set(bind_health[3], reptile.health.stress_level);
 }
 
 void UIManager::show_notification(const char* message, bool is_warning) {
-    if (!notification_area) return;
-    
-    lv_obj_t* notif_label = lv_label_create(notification_area);
-    lv_label_set_text(notif_label, message);
-    lv_obj_center(notif_label);
-    lv_obj_set_style_text_color(notif_label, lv_color_hex(0x2E3440), 0);
-    
-    lv_obj_clear_flag(notification_area, LV_OBJ_FLAG_HIDDEN);
-    
-    // Animation d'apparition
-    lv_anim_t anim;
-    lv_anim_init(&anim);
-    lv_anim_set_var(&anim, notification_area);
-    lv_anim_set_values(&anim, -100, 10);
-    lv_anim_set_time(&anim, 300);
-    lv_anim_set_exec_cb(&anim, (lv_anim_exec_xcb_t)lv_obj_set_y);
-    lv_anim_start(&anim);
-    
-    notification_visible = true;
-    
-    // Auto-masquage après 3 secondes
-    lv_timer_create([](lv_timer_t* timer) {
-        UIManager* ui = static_cast<UIManager*>(lv_timer_get_user_data(timer));
-        ui->hide_notification();
-        lv_timer_del(timer);
-    }, 3000, this);
+    // Clé = texte : un même message répété n'occupe qu'un toast
+    notify(NotificationCenter::make_key(message), message, is_warning ? NOTIF_WARNING : NOTIF_INFO);
+}
+
+void UIManager::notify(uint32_t key, const char* message, NotificationPriority priority,
+                       uint32_t cooldown_ms) {
+    if (!notification_timer) return;
+
+    uint32_t duration_ms = priority >= NOTIF_WARNING ? 5000 : 3000;
+    if (notifications.post(key, message, priority, lv_tick_get(), duration_ms, cooldown_ms) ==
+        NotificationCenter::POSTED) {
+        lv_timer_resume(notification_timer);
+        lv_timer_ready(notification_timer);
+    } else if (notifications.slot_changed()) {
+        // Texte d'un toast visible remplacé (ex. curseur en cours de réglage)
+        sync_toasts();
+    }
+}
+
+void UIManager::on_notification_timer(lv_timer_t* timer) {
+    UIManager* ui = static_cast<UIManager*>(lv_timer_get_user_data(timer));
+    ui->notifications.tick(lv_tick_get());
+    ui->sync_toasts();
+
+    if (ui->notifications.visible_count() == 0 && !ui->notifications.has_pending()) {
+        lv_timer_pause(timer);
+    }
+}
+
+void UIManager::sync_toasts() {
+    static const uint32_t colors[] = {0x88C0D0, 0xEBCB8B, 0xD08770, 0xBF616A};
+
+    for (uint8_t i = 0; i < NotificationCenter::SLOT_COUNT; i++) {
+        const NotificationCenter::Slot& slot = notifications.slot(i);
+        if (!slot.changed || !toasts[i]) continue;
+        notifications.acknowledge(i);
+
+        if (!slot.active) {
+            lv_obj_add_flag(toasts[i], LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+
+        lv_label_set_text(toast_labels[i], slot.notification.text);
+        lv_obj_set_style_bg_color(toasts[i], lv_color_hex(colors[slot.notification.priority]), 0);
+        if (lv_obj_has_flag(toasts[i], LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_clear_flag(toasts[i], LV_OBJ_FLAG_HIDDEN);
+
+            // Animation d'apparition
+            lv_anim_t anim;
+            lv_anim_init(&anim);
+            lv_anim_set_var(&anim, toasts[i]);
+            lv_anim_set_values(&anim, i * 56 - 100, i * 56);
+            lv_anim_set_time(&anim, 300);
+            lv_anim_set_exec_cb(&anim, (lv_anim_exec_xcb_t)lv_obj_set_y);
+            lv_anim_start(&anim);
+        }
+    }
 }
 
 void UIManager::animate_feeding(lv_obj_t* target) {
@@ -385,20 +537,8 @@ void UIManager::animate_feeding(lv_obj_t* target) {
 }
 
 void UIManager::hide_notification() {
-    if (!notification_visible) return;
-    
-    lv_anim_t anim;
-    lv_anim_init(&anim);
-    lv_anim_set_var(&anim, notification_area);
-    lv_anim_set_values(&anim, 10, -100);
-    lv_anim_set_time(&anim, 200);
-    lv_anim_set_exec_cb(&anim, (lv_anim_exec_xcb_t)lv_obj_set_y);
-    lv_anim_set_ready_cb(&anim, [](lv_anim_t* a) {
-        lv_obj_add_flag(static_cast<lv_obj_t*>(a->var), LV_OBJ_FLAG_HIDDEN);
-    });
-    lv_anim_start(&anim);
-    
-    notification_visible = false;
+    notifications.dismiss_all();
+    sync_toasts();
 }
 
 void UIManager::on_humidity_adjust(lv_event_t* e) {
@@ -406,11 +546,13 @@ void UIManager::on_humidity_adjust(lv_event_t* e) {
     lv_obj_t* slider = static_cast<lv_obj_t*>(lv_event_get_target(e));
     int32_t value = lv_slider_get_value(slider);
 
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    ui->bindings.invalidate(ui->bind_hum_slider);
+
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->adjust_humidity(selected, static_cast<float>(value))) {
         char msg[64];
         snprintf(msg, sizeof(msg), "💧 Humidité: %" PRId32 "%%", value);
-        ui->show_notification(msg, false);
+        ui->notify(NotificationCenter::make_key("humidité"), msg, NOTIF_INFO);
     }
 }
 
@@ -421,15 +563,212 @@ void UIManager::on_navigation_click(lv_event_t* e) {
     ui->switch_to_screen(index);
 }
 
+void UIManager::on_breeding_open(lv_event_t* e) {
+    UIManager* ui = static_cast<UIManager*>(lv_event_get_user_data(e));
+    ui->switch_to_screen(SCREEN_BREEDING);
+}
+
 void UIManager::switch_to_screen(uint8_t index) {
-    if (index >= screen_count || screens[index] == nullptr) return;
+    if (index >= screen_count) return;
+
+    if (screens[index] == nullptr) {
+        // Place libérée avant construction, d'après l'empreinte connue de l'écran
+        int8_t victim;
+        while ((victim = screen_cache.next_victim(index, current_screen)) != ScreenCache::NONE) {
+            evict_screen(victim);
+        }
+        if (!build_screen(index)) return;
+    }
+
+    // L'ancien écran n'est pas supprimé au chargement : le cache en décide
     current_screen = index;
+    screen_cache.touch(index);
     lv_scr_load_anim(screens[index], LV_SCR_LOAD_ANIM_NONE, 0, 0, false);
+
+    // Première construction : l'empreinte mesurée peut dépasser l'estimation
+    int8_t victim;
+    while ((victim = screen_cache.next_victim(index, current_screen)) != ScreenCache::NONE) {
+        evict_screen(victim);
+    }
+}
+
+bool UIManager::build_screen(uint8_t index) {
+    int64_t start = esp_timer_get_time();
+    size_t lvgl_before = lvgl_used_bytes();
+
+    lv_obj_t* screen = nullptr;
+    switch (index) {
+        case SCREEN_REPTILE_SELECT: screen = create_reptile_select_screen(); break;
+        case SCREEN_CARE:           screen = create_care_screen(); break;
+        case SCREEN_HABITAT:        screen = create_habitat_screen(); break;
+        case SCREEN_BREEDING:       screen = create_breeding_screen(); break;
+        case SCREEN_STATS:          screen = create_stats_screen(); break;
+        case SCREEN_SETTINGS:       screen = create_settings_screen(); break;
+        default: break;
+    }
+    if (!screen) {
+        ESP_LOGE(TAG, "Construction de l'écran %u impossible", index);
+        return false;
+    }
+    screens[index] = screen;
+
+    // Objets, styles et textes alloués par LVGL pendant la construction
+    size_t lvgl_after = lvgl_used_bytes();
+    uint32_t bytes = lvgl_after > lvgl_before ? (uint32_t)(lvgl_after - lvgl_before) : 0;
+    uint32_t build_us = (uint32_t)(esp_timer_get_time() - start);
+    screen_cache.record_build(index, bytes, build_us);
+    ESP_LOGI(TAG, "Écran %u construit en %u us, %u octets (cache: %u/%u octets)", index,
+             (unsigned)build_us, (unsigned)bytes, (unsigned)screen_cache.resident_bytes(),
+             (unsigned)screen_cache.get_budget());
+    return true;
+}
+
+void UIManager::evict_screen(uint8_t index) {
+    if (index == SCREEN_MAIN || index == current_screen || !screens[index]) return;
+    lv_obj_delete(screens[index]);
+    screens[index] = nullptr;
+    if (index == SCREEN_REPTILE_SELECT) reptile_list.detach();
+    if (index == SCREEN_STATS) vitals_chart.detach();
+    screen_cache.record_eviction(index);
+    ESP_LOGI(TAG, "Écran %u évincé du cache", index);
+}
+
+void UIManager::set_screen_budget(uint32_t bytes) {
+    screen_cache.set_budget(bytes);
+    int8_t victim;
+    while ((victim = screen_cache.next_victim(current_screen, current_screen)) != ScreenCache::NONE) {
+        evict_screen(victim);
+    }
+}
+
+lv_obj_t* UIManager::create_screen_frame(const char* title) {
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_add_style(screen, &style_bg, 0);
+
+    lv_obj_t* title_label = lv_label_create(screen);
+    lv_label_set_text(title_label, title);
+    lv_obj_set_style_text_font(title_label, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_color(title_label, lv_color_hex(0xECEFF4), 0);
+    lv_obj_set_pos(title_label, 20, 20);
+
+    // Retour à l'accueil
+    lv_obj_t* home_btn = lv_btn_create(screen);
+    lv_obj_add_style(home_btn, &style_btn_secondary, 0);
+    lv_obj_set_size(home_btn, 180, 50);
+    lv_obj_set_pos(home_btn, 824, 10);
+    lv_obj_t* home_label = lv_label_create(home_btn);
+    lv_label_set_text(home_label, "🏠 Accueil");
+    lv_obj_center(home_label);
+    lv_obj_set_user_data(home_btn, (void*)(intptr_t)SCREEN_MAIN);
+    lv_obj_add_event_cb(home_btn, on_navigation_click, LV_EVENT_CLICKED, this);
+
+    return screen;
+}
+
+lv_obj_t* UIManager::add_screen_card(lv_obj_t* screen, const char* text) {
+    lv_obj_t* card = lv_obj_create(screen);
+    lv_obj_add_style(card, &style_card, 0);
+    lv_obj_set_size(card, 984, 500);
+    lv_obj_set_pos(card, 20, 80);
+    card_layers.attach(card);
+
+    lv_obj_t* label = lv_label_create(card);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xD8DEE9), 0);
+    return card;
+}
+
+lv_obj_t* UIManager::create_reptile_select_screen() {
+    lv_obj_t* screen = create_screen_frame("🦎 Reptiles");
+    reptile_list.create(screen, 20, 80, 984, 500);
+    return screen;
+}
+
+void UIManager::on_reptile_selected(void* context, uint16_t) {
+    UIManager* ui = static_cast<UIManager*>(context);
+    ui->show_selected_reptile();
+    ui->switch_to_screen(SCREEN_MAIN);
+}
+
+void UIManager::show_selected_reptile() {
+    const Reptile* reptile = game_engine->peek_reptile(game_engine->get_selected_reptile());
+    if (reptile) lv_label_set_text(main_view.name_label, reptile->name);
+}
+
+void UIManager::on_gesture(void* context, const TouchGesture& gesture) {
+    static_cast<UIManager*>(context)->handle_gesture(gesture);
+}
+
+void UIManager::handle_gesture(const TouchGesture& gesture) {
+    switch (gesture.type) {
+        case GestureType::SWIPE_LEFT:
+        case GestureType::SWIPE_RIGHT: {
+            // Limité au panneau du reptile : les curseurs voisins gardent leurs glissés
+            if (current_screen != SCREEN_MAIN) return;
+            lv_area_t panel;
+            lv_obj_get_coords(reptile_info_panel, &panel);
+            lv_point_t start = {gesture.start_x, gesture.start_y};
+            if (!lv_area_is_point_on(&panel, &start, 0)) return;
+
+            size_t count = game_engine->get_reptile_count();
+            if (count < 2) return;
+            uint16_t selected = game_engine->get_selected_reptile();
+            uint16_t next = gesture.type == GestureType::SWIPE_LEFT ? (uint16_t)((selected + 1) % count)
+                                                                    : (uint16_t)((selected + count - 1) % count);
+            game_engine->select_reptile(next);
+            show_selected_reptile();
+            break;
+        }
+        case GestureType::PINCH: {
+            // Doigts écartés : palier plus fin ; rapprochés : vue plus large
+            if (current_screen != SCREEN_STATS || !vitals_chart.contains(gesture.start_x, gesture.start_y)) return;
+            uint8_t zoom = vitals_chart.get_zoom();
+            if (gesture.scale_permille > 1000 && zoom > 0) {
+                vitals_chart.set_zoom(zoom - 1);
+            } else if (gesture.scale_permille < 1000) {
+                vitals_chart.set_zoom(zoom + 1);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+lv_obj_t* UIManager::create_care_screen() {
+    lv_obj_t* screen = create_screen_frame("🏥 Soins");
+    add_screen_card(screen, "Historique des soins et traitements");
+    return screen;
+}
+
+lv_obj_t* UIManager::create_habitat_screen() {
+    lv_obj_t* screen = create_screen_frame("⚙️ Habitat");
+    add_screen_card(screen, "Réglages détaillés du terrarium");
+    return screen;
+}
+
+lv_obj_t* UIManager::create_breeding_screen() {
+    lv_obj_t* screen = create_screen_frame("👥 Reproduction");
+    add_screen_card(screen, "Couples, pontes et incubation");
+    return screen;
+}
+
+lv_obj_t* UIManager::create_stats_screen() {
+    lv_obj_t* screen = create_screen_frame("📊 Statistiques");
+    lv_obj_t* card = add_screen_card(screen, "Constantes du reptile sélectionné");
+    vitals_chart.create(card, 0, 24);
+    return screen;
+}
+
+lv_obj_t* UIManager::create_settings_screen() {
+    lv_obj_t* screen = create_screen_frame("⚙️ Paramètres");
+    add_screen_card(screen, "Affichage, sauvegarde et système");
+    return screen;
 }
 
 void UIManager::on_clean_terrarium(lv_event_t* e) {
     UIManager* ui = static_cast<UIManager*>(lv_event_get_user_data(e));
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->clean_terrarium(selected)) {
         ui->show_notification("🧹 Terrarium nettoyé", false);
     }
@@ -437,7 +776,7 @@ void UIManager::on_clean_terrarium(lv_event_t* e) {
 
 void UIManager::on_lighting_toggle(lv_event_t* e) {
     UIManager* ui = static_cast<UIManager*>(lv_event_get_user_data(e));
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->toggle_lighting(selected)) {
         ui->show_notification("💡 Éclairage basculé", false);
     }
@@ -445,36 +784,22 @@ void UIManager::on_lighting_toggle(lv_event_t* e) {
 
 void UIManager::on_health_check(lv_event_t* e) {
     UIManager* ui = static_cast<UIManager*>(lv_event_get_user_data(e));
-    uint8_t selected = ui->game_engine->get_selected_reptile();
+    uint16_t selected = ui->game_engine->get_selected_reptile();
     if (ui->game_engine->diagnose_health_issue(selected)) {
         ui->show_notification("🏥 Bilan de santé effectué", false);
     }
 }
 
 void UIManager::update_environment_display(const Reptile& reptile) {
-    if (!environment_controls) return;
-
-    lv_obj_t* temp_container = lv_obj_get_child(environment_controls, 1);
-    lv_obj_t* temp_label = lv_obj_get_child(temp_container, 0);
-    lv_obj_t* temp_slider = lv_obj_get_child(temp_container, 1);
-
-    char buf[64];
-    snprintf(buf, sizeof(buf), "🌡️ Température: %.0f°C", reptile.habitat.temperature_day);
-    lv_label_set_text(temp_label, buf);
-    lv_slider_set_value(temp_slider, static_cast<int32_t>(reptile.habitat.temperature_day), LV_ANIM_OFF);
-
-    lv_obj_t* hum_container = lv_obj_get_child(environment_controls, 2);
-    lv_obj_t* hum_label = lv_obj_get_child(hum_container, 0);
-    lv_obj_t* hum_slider = lv_obj_get_child(hum_container, 1);
-
-    snprintf(buf, sizeof(buf), "💧 Humidité: %.0f%%", reptile.habitat.humidity);
-    lv_label_set_text(hum_label, buf);
-    lv_slider_set_value(hum_slider, static_cast<int32_t>(reptile.habitat.humidity), LV_ANIM_OFF);
+    // Valeurs arrondies au degré / pourcent affiché : aucun appel LVGL,
+    // donc aucune invalidation, tant que l'affichage ne change pas
+    bindings.set(bind_temp_label, reptile.habitat.temperature_day);
+    bindings.set(bind_temp_slider, reptile.habitat.temperature_day);
+    bindings.set(bind_hum_label, reptile.habitat.humidity);
+    bindings.set(bind_hum_slider, reptile.habitat.humidity);
 }
 
 void UIManager::update_behavior_animation(const Reptile& reptile) {
-    if (!behavior_display) return;
-
     const char* icon;
     switch (reptile.current_behavior) {
         case Behavior::BASKING:      icon = "☀️ Basking"; break;
@@ -489,17 +814,66 @@ void UIManager::update_behavior_animation(const Reptile& reptile) {
         case Behavior::BRUMATION:    icon = "❄️ Brumation"; break;
         default:                     icon = "❓"; break;
     }
-    lv_label_set_text(behavior_display, icon);
+    bindings.set_text(bind_behavior, icon);
+}
+
+void UIManager::update_vitals_display(const Reptile& reptile) {
+    // Trois valeurs dans un seul label : texte réécrit seulement s'il diffère
+    char vitals[64];
+    snprintf(vitals, sizeof(vitals), "Âge: %u jours\nPoids: %u g\nTaille: %u mm",
+             reptile.age_days, reptile.weight_grams, reptile.length_mm);
+    if (strcmp(lv_label_get_text(main_view.vital_info), vitals) != 0) {
+        lv_label_set_text(main_view.vital_info, vitals);
+    }
+
+    // Heures écoulées selon l'horloge du moteur, au pas de l'heure affichée
+    uint32_t since_ms = game_engine->get_current_timestamp() - reptile.health.last_feeding;
+    bindings.set(bind_last_feeding, since_ms / 3600000.0f);
 }
 
 void UIManager::show_feeding_reminder(const char* reptile_name) {
     char msg[128];
     snprintf(msg, sizeof(msg), "🍝 Rappel: nourrir %s", reptile_name);
-    show_notification(msg, false);
+    // Appelé à chaque image tant que la faim dépasse le seuil : rappel toutes les 5 min au plus
+    notify(NotificationCenter::make_key("repas", reptile_name), msg, NOTIF_REMINDER, 5 * 60 * 1000);
 }
 
 void UIManager::show_health_alert(const char* reptile_name, const char* issue) {
     char msg[128];
     snprintf(msg, sizeof(msg), "⚠️ %s: %s", reptile_name, issue);
-    show_notification(msg, true);
-}
\ No newline at end of file
+    notify(NotificationCenter::make_key("santé", reptile_name), msg, NOTIF_CRITICAL, 60 * 1000);
+}
+
+void UIManager::log_report() const {
+    const UIBindings::Stats& stats = bindings.get_stats();
+    ESP_LOGI(TAG, "Liaisons UI: %u widgets, %u mises à jour, %u évitées",
+             (unsigned)bindings.size(), (unsigned)stats.widget_updates, (unsigned)stats.skipped);
+
+    const NotificationCenter::Stats& notif = notifications.get_stats();
+    ESP_LOGI(TAG, "Notifications: %u affichées, %u doublons, %u en récupération, %u rejetées",
+             (unsigned)notif.shown, (unsigned)notif.duplicates,
+             (unsigned)notif.cooldown_suppressed, (unsigned)notif.dropped);
+
+    const ReptileListView::Stats& list = reptile_list.get_stats();
+    ESP_LOGI(TAG, "Liste reptiles: %zu listés, %u lignes vivantes, %u tris (dernier %u us), %u reliaisons",
+             reptile_list.listed_count(), (unsigned)reptile_list.live_rows(), (unsigned)list.rebuilds,
+             (unsigned)list.last_rebuild_us, (unsigned)list.row_rebinds);
+
+    for (uint8_t i = 0; i < screen_count; i++) {
+        const ScreenCache::Entry& entry = screen_cache.entry(i);
+        if (entry.builds == 0) continue;
+        ESP_LOGI(TAG, "Écran %u: %s, %u octets, %u constructions (dernière %u us, max %u us), %u évictions",
+                 i, entry.built ? "résident" : "évincé", (unsigned)entry.bytes, (unsigned)entry.builds,
+                 (unsigned)entry.build_us_last, (unsigned)entry.build_us_max, (unsigned)entry.evictions);
+    }
+
+    const VitalsChart::Stats& chart = vitals_chart.get_stats();
+    ESP_LOGI(TAG, "Graphique constantes: %u échantillons, %u colonnes ajoutées, %u rechargements (dernier %u us), %u octets",
+             (unsigned)chart.samples, (unsigned)chart.columns_appended, (unsigned)chart.reloads,
+             (unsigned)chart.last_reload_us, (unsigned)vitals_chart.memory_bytes());
+
+    const CardLayerCache::Stats& layers = card_layers.get_stats();
+    ESP_LOGI(TAG, "Ombres de cartes: %s, %u rendues (dernière %u us), %u réutilisées, %u octets",
+             card_layers.is_enabled() ? "en cache" : "LVGL", (unsigned)layers.renders,
+             (unsigned)layers.last_render_us, (unsigned)layers.hits, (unsigned)layers.resident_bytes);
+}
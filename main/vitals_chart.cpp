@@ -0,0 +1,153 @@
+#include "include/vitals_chart.h"
+#include "esp_timer.h"
+#include <math.h>
+
+bool VitalsChart::init() {
+    return temperature.init(COLUMNS) && humidity.init(COLUMNS);
+}
+
+void VitalsChart::sample(uint16_t reptile_index, float temperature_c, float humidity_pct, uint32_t now_ms) {
+    if (reptile_index != subject) {
+        subject = reptile_index;
+        temperature.clear();
+        humidity.clear();
+        last_sample_ms = now_ms - SAMPLE_MS;
+        shown = 0;
+        if (chart) reload();
+    }
+    if (now_ms - last_sample_ms < SAMPLE_MS) return;
+    last_sample_ms = now_ms;
+
+    temperature.append((int16_t)lroundf(temperature_c * 10.0f));
+    humidity.append((int16_t)lroundf(humidity_pct * 10.0f));
+    stats.samples++;
+}
+
+void VitalsChart::create(lv_obj_t* parent, lv_coord_t x, lv_coord_t y) {
+    // Un niveau de zoom par palier : COLUMNS cases de 1, 4, 16, 64, 256 s
+    zoom_dropdown = lv_dropdown_create(parent);
+    lv_dropdown_set_options(zoom_dropdown, "8 min\n30 min\n2 h\n8 h\n33 h");
+    lv_dropdown_set_selected(zoom_dropdown, zoom);
+    lv_obj_set_size(zoom_dropdown, 160, 44);
+    lv_obj_set_pos(zoom_dropdown, x + COLUMNS * 2 - 160, y);
+    lv_obj_add_event_cb(zoom_dropdown, on_zoom_changed, LV_EVENT_VALUE_CHANGED, this);
+
+    lv_obj_t* legend = lv_label_create(parent);
+    lv_label_set_text(legend, "Température (orange, 15-40 °C) · Humidité (bleu, 0-100 %)");
+    lv_obj_set_style_text_color(legend, lv_color_hex(0xD8DEE9), 0);
+    lv_obj_set_pos(legend, x, y + 12);
+
+    chart = lv_chart_create(parent);
+    lv_obj_set_size(chart, COLUMNS * 2, 360);
+    lv_obj_set_pos(chart, x, y + 60);
+    lv_obj_set_style_bg_color(chart, lv_color_hex(0x2E3440), 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);     // Pas de marqueur par point
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_div_line_count(chart, 5, 0);
+    lv_chart_set_point_count(chart, COLUMNS * 2);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 150, 400);
+    lv_chart_set_range(chart, LV_CHART_AXIS_SECONDARY_Y, 0, 1000);
+    temp_series = lv_chart_add_series(chart, lv_color_hex(0xD08770), LV_CHART_AXIS_PRIMARY_Y);
+    hum_series = lv_chart_add_series(chart, lv_color_hex(0x88C0D0), LV_CHART_AXIS_SECONDARY_Y);
+
+    reload();
+}
+
+void VitalsChart::detach() {
+    // Objets supprimés avec l'écran parent ; l'historique est conservé
+    chart = nullptr;
+    zoom_dropdown = nullptr;
+    temp_series = nullptr;
+    hum_series = nullptr;
+}
+
+void VitalsChart::reload() {
+    int64_t start = esp_timer_get_time();
+    int32_t* temp_points = lv_chart_get_y_array(chart, temp_series);
+    int32_t* hum_points = lv_chart_get_y_array(chart, hum_series);
+    for (uint16_t i = 0; i < COLUMNS * 2; i++) {
+        temp_points[i] = LV_CHART_POINT_NONE;
+        hum_points[i] = LV_CHART_POINT_NONE;
+    }
+
+    // La case n occupe toujours la colonne n % COLUMNS ; une colonne vide
+    // devant le curseur sépare les valeurs récentes des plus anciennes
+    uint32_t done = temperature.completed_count(zoom);
+    uint32_t kept = temperature.stored(zoom);
+    if (kept > COLUMNS - 1u) kept = COLUMNS - 1u;
+    for (uint32_t sequence = done - kept; sequence < done; sequence++) {
+        uint16_t point = (uint16_t)(sequence % COLUMNS) * 2;
+        ChartBucket t = temperature.bucket(zoom, sequence);
+        ChartBucket h = humidity.bucket(zoom, sequence);
+        temp_points[point] = t.min;
+        temp_points[point + 1] = t.max;
+        hum_points[point] = h.min;
+        hum_points[point + 1] = h.max;
+    }
+    uint32_t cursor = (done % COLUMNS) * 2;
+    lv_chart_set_x_start_point(chart, temp_series, cursor);
+    lv_chart_set_x_start_point(chart, hum_series, cursor);
+    lv_chart_refresh(chart);
+
+    shown = done;
+    stats.reloads++;
+    stats.last_reload_us = (uint32_t)(esp_timer_get_time() - start);
+}
+
+void VitalsChart::append_column(uint32_t sequence) {
+    // Mode circulaire : chaque valeur n'invalide que la zone de son point
+    ChartBucket t = temperature.bucket(zoom, sequence);
+    ChartBucket h = humidity.bucket(zoom, sequence);
+    lv_chart_set_next_value(chart, temp_series, t.min);
+    lv_chart_set_next_value(chart, temp_series, t.max);
+    lv_chart_set_next_value(chart, hum_series, h.min);
+    lv_chart_set_next_value(chart, hum_series, h.max);
+
+    uint32_t gap = ((sequence + 1) % COLUMNS) * 2;
+    lv_chart_set_value_by_id(chart, temp_series, gap, LV_CHART_POINT_NONE);
+    lv_chart_set_value_by_id(chart, temp_series, gap + 1, LV_CHART_POINT_NONE);
+    lv_chart_set_value_by_id(chart, hum_series, gap, LV_CHART_POINT_NONE);
+    lv_chart_set_value_by_id(chart, hum_series, gap + 1, LV_CHART_POINT_NONE);
+    stats.columns_appended++;
+}
+
+void VitalsChart::update() {
+    if (!chart) return;
+    uint32_t done = temperature.completed_count(zoom);
+    if (done == shown) return;
+
+    // Gros retard (écran masqué longtemps) : un rechargement coûte moins
+    // que des dizaines d'invalidations ponctuelles
+    if (done - shown > COLUMNS / 8) {
+        reload();
+        return;
+    }
+    while (shown < done) append_column(shown++);
+}
+
+void VitalsChart::set_zoom(uint8_t tier) {
+    if (tier >= ChartSeries::TIER_COUNT || tier == zoom) return;
+    zoom = tier;
+    if (zoom_dropdown && lv_dropdown_get_selected(zoom_dropdown) != tier) {
+        lv_dropdown_set_selected(zoom_dropdown, tier);     // Zoom au pincement
+    }
+    if (chart) reload();
+}
+
+bool VitalsChart::contains(int32_t x, int32_t y) const {
+    if (!chart) return false;
+    lv_area_t coords;
+    lv_obj_get_coords(chart, &coords);
+    lv_point_t point = {x, y};
+    return lv_area_is_point_on(&coords, &point, 0);
+}
+
+void VitalsChart::on_zoom_changed(lv_event_t* e) {
+    VitalsChart* view = static_cast<VitalsChart*>(lv_event_get_user_data(e));
+    lv_obj_t* dropdown = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    view->set_zoom((uint8_t)lv_dropdown_get_selected(dropdown));
+}
@@ -0,0 +1,61 @@
+#include "autosave_policy.h"
+#include <iostream>
+
+static constexpr uint32_t DAY_MS = 24 * 60 * 60 * 1000;
+static constexpr size_t SAVE_BYTES = 4096; // Une image de 10 reptiles tient dans un secteur
+
+// Simule une journée à 10 Hz ; `weight_every_ms` = intervalle entre deux
+// changements mineurs (0 = aucun). Renvoie le nombre de sauvegardes.
+static uint32_t simulate_day(AutosavePolicy& policy, uint32_t start_ms, uint32_t weight_every_ms) {
+    uint32_t weight = 0;
+    uint32_t saves = 0;
+    for (uint32_t t = start_ms; t < start_ms + DAY_MS; t += 100) {
+        if (weight_every_ms && t % weight_every_ms == 0) weight++;
+        if (AutosavePolicy::should_save(policy.evaluate(t, weight, 0))) {
+            policy.record_write(t, SAVE_BYTES);
+            weight = 0;
+            saves++;
+        }
+    }
+    return saves;
+}
+
+int main() {
+    // Partie inactive : seule l'échéance maximale déclenche une écriture
+    {
+        AutosavePolicy policy;
+        uint32_t saves = simulate_day(policy, 0, 0);
+        if (saves > DAY_MS / policy.get_config().max_interval_ms) return 1;
+    }
+
+    // Partie intensive : plafonnée par le budget quotidien
+    {
+        AutosavePolicy policy;
+        uint64_t budget = policy.daily_budget_bytes();
+        simulate_day(policy, 0, 1000); // Première journée (seau plein au départ)
+        uint64_t before = policy.get_lifetime_erased();
+        simulate_day(policy, DAY_MS, 1000);
+        uint64_t erased = policy.get_lifetime_erased() - before;
+        if (erased > budget + SAVE_BYTES) return 1;
+        // L'ancien rythme fixe (toutes les 10 s) aurait effacé bien plus
+        if (erased * 4 > (uint64_t)(DAY_MS / 10000) * SAVE_BYTES) return 1;
+        // Au rythme du budget, la durée de vie visée est tenue
+        if (policy.projected_lifetime_days(2 * DAY_MS) + 1 < policy.get_config().target_lifetime_days) return 1;
+    }
+
+    // Un événement important passe outre le budget et l'intervalle minimal
+    {
+        AutosavePolicy policy;
+        AutosavePolicy::Config config = policy.get_config();
+        config.target_lifetime_days = 1000000; // Budget quasi nul
+        policy.configure(config);
+        policy.evaluate(0, 0, 0);
+        policy.record_write(0, 1 << 20);
+        if (policy.evaluate(20000, 100, 0) != AutosavePolicy::DEFER_BUDGET) return 1;
+        if (policy.evaluate(20100, 0, 1) != AutosavePolicy::SAVE_EVENT) return 1;
+        if (policy.evaluate(20200, 0, 0) != AutosavePolicy::SKIP_CLEAN) return 1;
+    }
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "card_layer.h"
+#include <iostream>
+#include <vector>
+
+static uint16_t rgb565(uint32_t rgb) {
+    return (uint16_t)((((rgb >> 16) & 0xFF) >> 3) << 11 | (((rgb >> 8) & 0xFF) >> 2) << 5 | ((rgb & 0xFF) >> 3));
+}
+
+static uint16_t green(uint16_t pixel) {
+    return (pixel >> 5) & 0x3F;
+}
+
+int main() {
+    CardLayerKey key = {480, 200, 12, 8, 76, 0x3B4252, 0x000000, 0x2E3440};
+
+    // Intérieur : remplissage de la carte ; au-delà du débord : fond parent
+    if (card_layer_pixel(key, 240, 100) != rgb565(0x3B4252)) return 1;
+    if (card_layer_extent(key) != 5) return 1;
+    if (card_layer_pixel(key, -5, 100) != rgb565(0x2E3440)) return 1;
+
+    // Ombre plus sombre près du bord, coin arrondi hors de la carte
+    uint16_t near = card_layer_pixel(key, -1, 100);
+    uint16_t far = card_layer_pixel(key, -4, 100);
+    if (!(green(near) < green(far) && green(far) <= green(rgb565(0x2E3440)))) return 1;
+    if (card_layer_pixel(key, 0, 0) == rgb565(0x3B4252)) return 1;
+
+    // Bandes : l'anneau seul, sans l'intérieur de la carte
+    CardStripRect top = card_layer_strip(key, CARD_STRIP_TOP);
+    CardStripRect left = card_layer_strip(key, CARD_STRIP_LEFT);
+    if (top.x != -5 || top.y != -5 || top.width != 490 || top.height != 17) return 1;
+    if (left.width != 5 || left.height != 176) return 1;
+    if (card_layer_bytes(key) != 2 * (2 * 490 * 17 + 2 * 5 * 176)) return 1;
+
+    std::vector<uint16_t> strip(top.width * top.height);
+    card_layer_render(key, CARD_STRIP_TOP, strip.data());
+    if (strip[0] != card_layer_pixel(key, -5, -5)) return 1;
+    if (strip[16 * top.width + 245] != card_layer_pixel(key, 240, 11)) return 1;
+
+    // Rayon borné par la hauteur d'une carte très basse
+    CardLayerKey thin = key;
+    thin.height = 10;
+    if (card_layer_strip(thin, CARD_STRIP_LEFT).height != 0) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
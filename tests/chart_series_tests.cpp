@@ -0,0 +1,42 @@
+#include "chart_series.h"
+#include <iostream>
+
+int main() {
+    ChartSeries series;
+    if (!series.init(64)) return 1;
+
+    // 1000 échantillons en dent de scie avec un pic isolé
+    for (int i = 0; i < 1000; i++) {
+        series.append(i == 517 ? 900 : (int16_t)(i % 50));
+    }
+    if (series.completed_count(0) != 1000 || series.stored(0) != 64) return 1;
+    if (series.completed_count(1) != 250 || series.completed_count(2) != 62) return 1;
+    if (series.completed_count(4) != 3) return 1;
+
+    // Ajout incrémental : la case la plus récente du palier 0 est le dernier échantillon
+    ChartBucket last = series.bucket(0, 999);
+    if (last.min != 49 || last.max != 49) return 1;
+    // Cases écrasées par l'anneau : plus disponibles
+    if (series.bucket(0, 900).min != 0 || series.bucket(0, 900).max != 0) return 1;
+
+    // Min/max préservés à chaque palier : le pic reste visible dézoomé
+    ChartBucket peak = series.bucket(2, 517 / 16);  // Échantillons 512..527
+    if (peak.max != 900 || peak.min != 12) return 1;
+    ChartBucket calm = series.bucket(1, 240);   // Échantillons 960..963
+    if (calm.min != 10 || calm.max != 13) return 1;
+
+    // Choix du palier : colonnes * échantillons par case >= durée affichée
+    if (ChartSeries::samples_per_bucket(3) != 64) return 1;
+    if (ChartSeries::tier_for_span(464, 464) != 0) return 1;
+    if (ChartSeries::tier_for_span(465, 464) != 1) return 1;
+    if (ChartSeries::tier_for_span(464 * 256, 464) != 4) return 1;
+    if (ChartSeries::tier_for_span(UINT32_MAX, 464) != ChartSeries::TIER_COUNT - 1) return 1;
+
+    series.clear();
+    if (series.completed_count(0) != 0 || series.stored(3) != 0) return 1;
+    series.append(5);
+    if (series.bucket(0, 0).max != 5) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
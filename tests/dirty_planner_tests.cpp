@@ -0,0 +1,42 @@
+#include "dirty_planner.h"
+#include <iostream>
+
+int main() {
+    DirtyPlanner planner;
+    planner.configure(1024, 600, {4096, 32, 4});
+
+    // Alignement sur 32 px, bornes de l'écran respectées
+    DirtyRect single[] = {{40, 10, 50, 20}, {1010, 590, 1023, 599}};
+    DirtyPlanner::Result result = planner.plan(single, 2);
+    if (result.areas_out != 2) return 1;
+    if (single[0].x1 != 32 || single[0].x2 != 63 || single[0].y1 != 10) return 1;
+    if (single[1].x1 != 992 || single[1].x2 != 1023) return 1;
+
+    // Deux étiquettes voisines : fusion moins chère qu'un flush supplémentaire
+    DirtyRect labels[] = {{100, 100, 190, 120}, {100, 125, 190, 145}};
+    result = planner.plan(labels, 2);
+    if (result.areas_out != 1 || labels[0].y1 != 100 || labels[0].y2 != 145) return 1;
+    if (result.requested_px != 2 * 91 * 21) return 1;
+    if (labels[0].x1 != 96 || labels[0].x2 != 191 || result.flushed_px != 96 * 46) return 1;
+
+    // Zones éloignées : la fusion redessinerait trop de pixels
+    DirtyRect far[] = {{0, 0, 63, 31}, {896, 500, 959, 531}};
+    result = planner.plan(far, 2);
+    if (result.areas_out != 2 || result.flushed_px != result.requested_px) return 1;
+
+    // Plafond de fragmentation : au plus 4 zones, quel que soit le surcoût
+    DirtyRect many[10];
+    for (int i = 0; i < 10; i++) many[i] = {i * 100, i * 55, i * 100 + 31, i * 55 + 9};
+    result = planner.plan(many, 10);
+    if (result.areas_in != 10 || result.areas_out != 4) return 1;
+    if (result.flushed_px < result.requested_px) return 1;
+
+    // Zones incluses dans une autre : absorbées sans surcoût
+    DirtyRect nested[] = {{0, 0, 255, 255}, {64, 64, 127, 127}, {0, 0, 31, 0}};
+    result = planner.plan(nested, 3);
+    if (result.areas_out != 1 || nested[0].x2 != 255 || nested[0].y2 != 255) return 1;
+    if (result.flushed_px != 256 * 256) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
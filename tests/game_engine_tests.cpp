@@ -1,6 +1,8 @@
 #include "game_engine.h"
 #include "species_database.h"
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 int main() {
     GameEngine engine;
@@ -21,6 +23,24 @@ int main() {
 
     if (!engine.remove_reptile(0)) return 1;
     if (engine.get_reptile_count() != 1) return 1;
+
+    // Projection : le tick en régime établi ne copie rien en RAM
+    for (int i = 0; i < 200; i++) engine.update(100);
+    const size_t stride = sizeof(Reptile) + 4;
+    std::vector<uint8_t> image(stride);
+    memcpy(image.data(), engine.peek_reptile(0), sizeof(Reptile));
+
+    GameEngine mapped;
+    mapped.attach_mapped_reptiles(image.data(), stride, 1);
+    mapped.update(200 * 100 + 1000);    // Horloge rattrapée sur celle de l'enregistrement
+    for (int i = 0; i < 50; i++) mapped.update(100);
+    if (!mapped.has_mapped_reptiles()) return 1;
+
+    // Première vraie écriture : copie, horodatage du dernier tick repris
+    if (!mapped.handle_reptile(0)) return 1;
+    if (mapped.has_mapped_reptiles()) return 1;
+    if (mapped.peek_reptile(0)->experience_points != engine.peek_reptile(0)->experience_points + 1) return 1;
+    if (mapped.peek_reptile(0)->last_update == engine.peek_reptile(0)->last_update) return 1;
     std::cout << "OK" << std::endl;
     return 0;
 }
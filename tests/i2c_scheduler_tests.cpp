@@ -0,0 +1,70 @@
+#include "i2c_scheduler.h"
+#include <iostream>
+
+static I2cRequest make(uint8_t device, I2cPriority priority, uint8_t reg, uint8_t value, uint16_t rx_len = 0) {
+    I2cRequest request = {};
+    request.device = device;
+    request.priority = priority;
+    request.tx_len = rx_len ? 1 : 2;
+    request.tx[0] = reg;
+    request.tx[1] = value;
+    request.rx_len = rx_len;
+    return request;
+}
+
+int main() {
+    I2cScheduler scheduler;
+    I2cRequest out;
+    if (scheduler.pop(out, 0xFF)) return 1;
+
+    // Priorité d'abord : capteur, expander puis tactile soumis dans cet ordre
+    scheduler.push(make(2, I2cPriority::SENSOR, 0x10, 0));
+    scheduler.push(make(1, I2cPriority::EXPANDER, 0x70, 1));
+    scheduler.push(make(0, I2cPriority::TOUCH, 0x02, 0, 31));
+    if (!scheduler.pop(out, 0xFF) || out.device != 0) return 1;
+    if (!scheduler.pop(out, 0xFF) || out.device != 1) return 1;
+    if (!scheduler.pop(out, 0xFF) || out.device != 2) return 1;
+    if (scheduler.size() != 0) return 1;
+
+    // Même registre : la dernière valeur remplace l'écriture en attente
+    if (scheduler.push(make(1, I2cPriority::EXPANDER, 0x74, 1)) != I2cScheduler::PushResult::QUEUED) return 1;
+    if (scheduler.push(make(1, I2cPriority::EXPANDER, 0x74, 0)) != I2cScheduler::PushResult::MERGED) return 1;
+    if (scheduler.push(make(1, I2cPriority::EXPANDER, 0x72, 1)) != I2cScheduler::PushResult::QUEUED) return 1;
+    if (scheduler.size() != 2) return 1;
+    if (!scheduler.pop(out, 0xFF) || out.tx[0] != 0x74 || out.tx[1] != 0) return 1;
+    if (!scheduler.pop(out, 0xFF) || out.tx[0] != 0x72) return 1;
+
+    // Une écriture avec rappel n'est jamais fusionnée (l'appelant attend sa fin)
+    I2cRequest waited = make(1, I2cPriority::EXPANDER, 0x74, 1);
+    waited.done = [](void*, I2cStatus) {};
+    scheduler.push(waited);
+    if (scheduler.push(make(1, I2cPriority::EXPANDER, 0x74, 0)) != I2cScheduler::PushResult::QUEUED) return 1;
+    while (scheduler.pop(out, 0xFF)) {}
+
+    // À priorité égale, les écritures du dernier périphérique servi s'enchaînent
+    scheduler.push(make(3, I2cPriority::SENSOR, 0x01, 0));
+    scheduler.push(make(4, I2cPriority::SENSOR, 0x01, 0));
+    scheduler.push(make(3, I2cPriority::SENSOR, 0x02, 0));
+    if (!scheduler.pop(out, 0xFF) || out.device != 3 || out.tx[0] != 0x01) return 1;
+    if (!scheduler.pop(out, out.device) || out.device != 3 || out.tx[0] != 0x02) return 1;
+    if (!scheduler.pop(out, out.device) || out.device != 4) return 1;
+
+    // File pleine : rejet
+    for (int i = 0; i < I2C_QUEUE_LENGTH; i++) {
+        if (scheduler.push(make(0, I2cPriority::TOUCH, 0x02, 0, 31)) != I2cScheduler::PushResult::QUEUED) return 1;
+    }
+    if (scheduler.push(make(0, I2cPriority::TOUCH, 0x02, 0, 31)) != I2cScheduler::PushResult::FULL) return 1;
+
+    // Relevé par périphérique, remis à zéro à la lecture
+    scheduler.record(0, 1200, 800, I2cStatus::OK);
+    scheduler.record(0, 25000, 20000, I2cStatus::TIMEOUT);
+    scheduler.record(0, 900, 700, I2cStatus::ERROR);
+    I2cDeviceStats stats = scheduler.take_stats(0);
+    if (stats.transactions != 3 || stats.timeouts != 1 || stats.errors != 1) return 1;
+    if (stats.latency_sum_us != 27100 || stats.latency_max_us != 25000 || stats.bus_us != 21500) return 1;
+    if (scheduler.take_stats(0).transactions != 0) return 1;
+    if (scheduler.take_stats(1).merged != 1) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "notification_center.h"
+#include <cstring>
+#include <iostream>
+
+int main() {
+    NotificationCenter center;
+    uint32_t now = 1000;
+
+    // Rappel appelé à chaque image : un seul toast, puis délai de récupération
+    uint32_t reminder = NotificationCenter::make_key("repas", "Alpha");
+    if (reminder == NotificationCenter::make_key("repas", "Beta")) return 1;
+    if (center.post(reminder, "Rappel", NOTIF_REMINDER, now, 3000, 60000) != NotificationCenter::POSTED) return 1;
+    for (int frame = 0; frame < 90; frame++) {
+        now += 33;
+        center.post(reminder, "Rappel", NOTIF_REMINDER, now, 3000, 60000);
+        center.tick(now);
+    }
+    const NotificationCenter::Stats& stats = center.get_stats();
+    if (stats.posted != 1 || stats.shown != 1) return 1;
+    if (stats.duplicates + stats.cooldown_suppressed != 90) return 1;
+    if (center.visible_count() != 1 || center.next_deadline(now) > 3000) return 1;
+
+    now += 3000;
+    center.tick(now);
+    if (center.visible_count() != 0 || !center.slot(0).changed) return 1;
+    center.acknowledge(0);
+    if (center.post(reminder, "Rappel", NOTIF_REMINDER, now) != NotificationCenter::COOLDOWN) return 1;
+    now += 60000;
+    if (center.post(reminder, "Rappel", NOTIF_REMINDER, now) != NotificationCenter::POSTED) return 1;
+    center.tick(now);
+    center.dismiss_all();
+
+    // Même clé, nouveau texte : le toast visible est réécrit sur place
+    uint32_t slider = NotificationCenter::make_key("température");
+    center.post(slider, "30", NOTIF_INFO, now);
+    center.tick(now);
+    for (uint8_t i = 0; i < NotificationCenter::SLOT_COUNT; i++) center.acknowledge(i);
+    if (center.post(slider, "31", NOTIF_INFO, now + 10) != NotificationCenter::DUPLICATE) return 1;
+    if (!center.slot_changed()) return 1;
+    bool found = false;
+    for (uint8_t i = 0; i < NotificationCenter::SLOT_COUNT; i++) {
+        if (center.slot(i).active && strcmp(center.slot(i).notification.text, "31") == 0) found = true;
+    }
+    if (!found) return 1;
+    center.dismiss_all();
+    center.tick(now);
+
+    // File par priorité : une alerte critique préempte un toast d'information
+    for (uint32_t k = 0; k < NotificationCenter::SLOT_COUNT; k++) {
+        center.post(100 + k, "info", NOTIF_INFO, now);
+    }
+    center.tick(now);
+    if (center.visible_count() != NotificationCenter::SLOT_COUNT) return 1;
+    center.post(200, "critique", NOTIF_CRITICAL, now);
+    center.tick(now);
+    if (center.get_stats().preempted != 1 || center.has_pending()) return 1;
+
+    // File pleine : les messages moins prioritaires sont rejetés
+    for (uint32_t k = 0; k < NotificationCenter::QUEUE_SIZE; k++) {
+        center.post(300 + k, "rappel", NOTIF_REMINDER, now);
+    }
+    if (center.post(400, "info", NOTIF_INFO, now) != NotificationCenter::DROPPED) return 1;
+    if (center.post(401, "alerte", NOTIF_WARNING, now) != NotificationCenter::POSTED) return 1;
+    if (center.queued_count() != NotificationCenter::QUEUE_SIZE) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
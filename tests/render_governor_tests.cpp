@@ -0,0 +1,69 @@
+#include "render_governor.h"
+#include <iostream>
+
+int main() {
+    RenderGovernor governor;
+    RenderGovernor::Config config = {60000, 300000, 1000, 33, 1000, 100, 1000};
+    governor.configure(config, 0);
+
+    // Démarrage : relevé du modèle immédiat
+    if (!governor.model_due(0) || governor.next_sleep_ms(0, 33) != 0) return 1;
+    governor.model_done(0);
+
+    // Entrée récente : lecture tactile à 33 ms
+    if (!governor.input_active(500) || governor.next_sleep_ms(500, 200) != 33) return 1;
+
+    // Au repos : sommeil jusqu'à la minuterie LVGL ou au relevé du modèle
+    governor.model_done(1500);
+    if (governor.input_active(1500)) return 1;
+    if (governor.next_sleep_ms(1500, 200) != 200) return 1;
+    if (governor.next_sleep_ms(1500, UINT32_MAX) != 1000) return 1;
+    if (governor.next_sleep_ms(2100, UINT32_MAX) != 400) return 1;
+    if (governor.model_due(2100) || !governor.model_due(2500)) return 1;
+
+    // Changement du modèle : relevé sans attendre
+    governor.on_model_change();
+    if (!governor.model_due(2200) || governor.next_sleep_ms(2200, 500) != 0) return 1;
+    governor.model_done(2200);
+
+    // Échéance de l'atténuation plus proche que le relevé
+    governor.model_done(59500);
+    if (governor.next_sleep_ms(59500, UINT32_MAX) != 500) return 1;
+
+    // Inactivité : ACTIVE -> DIM -> OFF, un changement à la fois
+    if (governor.update_state(59999)) return 1;
+    if (!governor.update_state(60000) || governor.get_state() != RenderGovernor::PowerState::DIM) return 1;
+    if (governor.update_state(60001)) return 1;
+
+    // DIM : LVGL plafonné à une passe toutes les 100 ms
+    governor.lvgl_done(60000);
+    if (governor.lvgl_due(60050) || !governor.lvgl_due(60100)) return 1;
+    if (governor.next_sleep_ms(60050, 0) != 50) return 1;
+
+    if (!governor.update_state(300000) || governor.get_state() != RenderGovernor::PowerState::OFF) return 1;
+    // OFF : LVGL ne tourne plus, le modèle reste relevé
+    if (governor.lvgl_due(300000)) return 1;
+    governor.model_done(300000);
+    if (governor.next_sleep_ms(300000, 0) != 1000) return 1;
+
+    // Toucher de réveil : signalé pour être absorbé, retour direct en ACTIVE
+    if (!governor.on_input(301000)) return 1;
+    if (governor.get_state() != RenderGovernor::PowerState::ACTIVE || !governor.model_due(301000)) return 1;
+    if (governor.on_input(301010)) return 1;
+
+    // Saut direct en OFF après une longue absence de réveil
+    governor.configure(config, 0);
+    if (!governor.update_state(400000) || governor.get_state() != RenderGovernor::PowerState::OFF) return 1;
+
+    // Relevé des réveils remis à zéro
+    governor.record_wakeup(true, 1500);
+    governor.record_wakeup(false, 500);
+    RenderGovernor::Stats stats = governor.take_stats();
+    if (stats.wakeups != 2 || stats.input_wakeups != 1 || stats.awake_us != 2000) return 1;
+    // DIM, OFF, réveil, puis OFF après reconfiguration
+    if (stats.transitions != 4) return 1;
+    if (governor.take_stats().wakeups != 0) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
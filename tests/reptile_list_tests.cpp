@@ -0,0 +1,116 @@
+#include "reptile_list.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+int main() {
+    // 10 000 reptiles : au-delà des anciens indices sur 8 bits
+    GameEngine engine;
+    std::vector<Reptile> many(10000);
+    for (size_t i = 0; i < many.size(); i++) {
+        snprintf(many[i].name, sizeof(many[i].name), "R%05zu", many.size() - 1 - i);
+        many[i].species = (ReptileSpecies)(i % REPTILE_SPECIES_COUNT);
+        many[i].health.overall_health = (uint8_t)(i % 101);
+        many[i].health.hydration = 100;
+    }
+    engine.set_reptiles(many);
+    engine.select_reptile(9000);
+    if (engine.get_selected_reptile() != 9000) return 1;
+
+    ReptileListModel model;
+    if (!model.refresh(engine) || model.size() != 10000) return 1;
+    if (model.refresh(engine)) return 1; // Rien n'a changé : pas de nouveau tri
+    if (strcmp(engine.peek_reptile(model.engine_index(0))->name, "R00000") != 0) return 1;
+
+    model.set_sort(ReptileSort::HEALTH);
+    model.refresh(engine);
+    if (engine.peek_reptile(model.engine_index(0))->health.overall_health != 0) return 1;
+
+    model.set_filter(ReptileFilter::CRITICAL);
+    model.set_species(3);
+    model.refresh(engine);
+    for (size_t row = 0; row < model.size(); row++) {
+        const Reptile* r = engine.peek_reptile(model.engine_index(row));
+        if (r->health.overall_health >= 30 || (int)r->species != 3) return 1;
+    }
+    if (model.size() == 0) return 1;
+
+    model.set_filter(ReptileFilter::URGENT);
+    model.set_species(ReptileListModel::ALL_SPECIES);
+    model.set_sort(ReptileSort::URGENCY);
+    model.refresh(engine);
+    for (size_t row = 1; row < model.size(); row++) {
+        if (reptile_urgency(*engine.peek_reptile(model.engine_index(row))) >
+            reptile_urgency(*engine.peek_reptile(model.engine_index(row - 1)))) return 1;
+    }
+
+    // Tri sur une valeur vivante : un relevé suit la simulation sans changement de population
+    model.set_filter(ReptileFilter::ALL);
+    model.set_sort(ReptileSort::HEALTH);
+    model.refresh(engine);
+    if (!model.depends_on_live_values()) return 1;
+    model.mark_stale();
+    if (model.refresh(engine)) return 1; // Ordre identique : rien à relier
+    for (size_t n = 0; n < 10000 / ReptileListModel::LIVE_SCAN_PER_REFRESH + 1; n++) {
+        if (model.refresh(engine)) return 1; // Clés inchangées : aucun déplacement
+    }
+    // Seule la ligne dont la santé a bougé est repositionnée, par tranches bornées
+    uint16_t weakest = model.engine_index(0);
+    engine.get_reptile(weakest)->health.overall_health = 100;
+    bool moved = false;
+    for (size_t n = 0; n < 10000 / ReptileListModel::LIVE_SCAN_PER_REFRESH + 1 && !moved; n++) {
+        moved = model.refresh(engine);
+    }
+    if (!moved || model.engine_index(0) == weakest || model.size() != 10000) return 1;
+    for (size_t row = 1; row < model.size(); row++) {
+        if (engine.peek_reptile(model.engine_index(row))->health.overall_health <
+            engine.peek_reptile(model.engine_index(row - 1))->health.overall_health) return 1;
+    }
+    // Filtre vivant : la ligne sort du filtre sans reconstruction complète
+    model.set_filter(ReptileFilter::CRITICAL);
+    model.refresh(engine);
+    size_t critical = model.size();
+    engine.get_reptile(model.engine_index(0))->health.overall_health = 90;
+    for (size_t n = 0; n < 10000 / ReptileListModel::LIVE_SCAN_PER_REFRESH + 1; n++) model.refresh(engine);
+    if (model.size() != critical - 1) return 1;
+    model.set_filter(ReptileFilter::ALL);
+    model.set_sort(ReptileSort::NAME);
+    if (model.depends_on_live_values()) return 1;
+
+    // Fenêtre : pool constant, seules les lignes entrantes sont reliées
+    VirtualWindow window;
+    window.configure(56, 444, 2);
+    uint8_t pool = window.pool_size();
+    if (pool != 13) return 1;
+    if (window.update(0, 10000) != pool) return 1;
+    for (uint8_t s = 0; s < pool; s++) window.clear_dirty(s);
+    if (window.update(0, 10000) != 0) return 1;
+
+    // Une ligne de défilement au-delà de la marge : une seule reliaison
+    window.update(56 * 3, 10000);
+    for (uint8_t s = 0; s < pool; s++) window.clear_dirty(s);
+    if (window.update(56 * 4, 10000) != 1) return 1;
+    for (uint8_t s = 0; s < pool; s++) window.clear_dirty(s);
+
+    // Saut en fin de liste : fenêtre bornée, chaque élément unique
+    window.update(56 * 9990, 10000);
+    if (window.end() != 10000 || window.end() - window.first() != pool) return 1;
+    bool seen[13] = {};
+    for (uint8_t s = 0; s < pool; s++) {
+        int32_t item = window.slot_item(s);
+        if (item < (int32_t)window.first() || item >= (int32_t)window.end()) return 1;
+        if (seen[item - window.first()]) return 1;
+        seen[item - window.first()] = true;
+    }
+
+    // Liste courte : emplacements en trop libérés
+    window.update(0, 5);
+    uint8_t used = 0;
+    for (uint8_t s = 0; s < pool; s++) {
+        if (window.slot_item(s) != VirtualWindow::NO_ITEM) used++;
+    }
+    if (used != 5) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "rgb565_kernels.h"
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+static uint32_t seed = 12345;
+static uint32_t next_random() {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+// Une passe par jeu d'instructions disponible, comparée octet par octet à la
+// référence scalaire ; largeurs impaires et pas plus larges que la zone
+static bool check_isa(rgb565_isa_t isa) {
+    const int32_t widths[] = {1, 7, 8, 15, 16, 17, 33, 100};
+    const uint8_t opas[] = {255, 254, 128, 3, 0};
+    const int32_t h = 5;
+    const int32_t stride_px = 112;
+
+    for (int32_t w : widths) {
+        std::vector<uint16_t> bg(stride_px * h), src(stride_px * h), got, want;
+        std::vector<uint8_t> mask(stride_px * h);
+        for (auto& px : bg) px = (uint16_t)next_random();
+        for (auto& px : src) px = (uint16_t)next_random();
+        for (size_t i = 0; i < mask.size(); i++) mask[i] = i % 5 == 0 ? 255 : i % 7 == 0 ? 0 : (uint8_t)next_random();
+
+        for (uint8_t opa : opas) {
+            for (int with_mask = 0; with_mask < 2; with_mask++) {
+                const uint8_t* m = with_mask ? mask.data() : nullptr;
+                uint16_t color = (uint16_t)next_random();
+
+                got = bg;
+                want = bg;
+                rgb565_fill_scalar(want.data(), w, h, stride_px * 2, color, m, stride_px, opa);
+                if (!rgb565_fill(got.data(), w, h, stride_px * 2, color, m, stride_px, opa)) {
+                    // Seul le remplissage uni est vectorisé sur l'ESP32-S3
+                    if (isa != RGB565_ISA_PIE && isa != RGB565_ISA_NONE) return false;
+                    got = want;
+                }
+                if (got != want) return false;
+
+                got = bg;
+                want = bg;
+                rgb565_blend_scalar(want.data(), w, h, stride_px * 2, src.data(), stride_px * 2, m, stride_px, opa);
+                if (!rgb565_blend(got.data(), w, h, stride_px * 2, src.data(), stride_px * 2, m, stride_px, opa)) {
+                    if (isa == RGB565_ISA_SSE2 || isa == RGB565_ISA_AVX2) return false;
+                    got = want;
+                }
+                if (got != want) return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    // Référence : formule de LVGL, canal par canal (128 -> 16/32, arrondi par défaut)
+    uint16_t px = 0x0000;
+    rgb565_fill_scalar(&px, 1, 1, 2, 0xFFFF, nullptr, 0, 128);
+    if (px != ((15 << 11) | (31 << 5) | 15)) return 1;
+    px = 0x1234;
+    rgb565_fill_scalar(&px, 1, 1, 2, 0xFFFF, nullptr, 0, 0);
+    if (px != 0x1234) return 1;
+    uint8_t full = 255;
+    rgb565_fill_scalar(&px, 1, 1, 2, 0xF800, &full, 1, 255);
+    if (px != 0xF800) return 1;
+    // Masque combiné à l'opacité : (255 * 128) >> 8 = 127, puis 5 bits
+    uint8_t half = 255;
+    px = 0x0000;
+    rgb565_fill_scalar(&px, 1, 1, 2, 0xFFFF, &half, 1, 128);
+    if (px != ((15 << 11) | (31 << 5) | 15)) return 1;
+
+    // Copie d'image opaque : octets de la source tels quels
+    uint16_t src[3] = {1, 2, 3}, dst[3] = {};
+    rgb565_blend_scalar(dst, 3, 1, 6, src, 6, nullptr, 0, 255);
+    if (memcmp(src, dst, sizeof(src))) return 1;
+
+    // Jeu forcé au-delà du détecté : refusé
+    rgb565_isa_t detected = rgb565_get_isa();
+    rgb565_force_isa(RGB565_ISA_PIE);
+    if (detected != RGB565_ISA_PIE && rgb565_get_isa() == RGB565_ISA_PIE) return 1;
+
+    const rgb565_isa_t levels[] = {RGB565_ISA_NONE, RGB565_ISA_SSE2, RGB565_ISA_AVX2, RGB565_ISA_PIE};
+    for (rgb565_isa_t isa : levels) {
+        rgb565_force_isa(isa);
+        if (rgb565_get_isa() != isa) continue;
+        if (!check_isa(isa)) {
+            std::cout << "écart " << rgb565_isa_name(isa) << "\n";
+            return 1;
+        }
+        std::cout << "rgb565 " << rgb565_isa_name(isa) << " identique\n";
+    }
+    rgb565_force_isa(detected);
+
+    std::cout << "OK\n";
+    return 0;
+}
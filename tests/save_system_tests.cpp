@@ -0,0 +1,302 @@
+#include "crc32c.h"
+#include "game_engine.h"
+#include "health_system.h"
+#include "save_system.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+static const char* IMAGE_PATH = "/tmp/reptile_save_test.img";
+
+int main() {
+    std::remove(IMAGE_PATH);
+    nvs_stub_store().clear();
+    SavePartition::set_host_path(IMAGE_PATH);
+
+    // Vecteur de référence CRC-32C et chaînage
+    if (crc32c("123456789", 9) != 0xE3069283) return 1;
+    if (crc32c("6789", 4, crc32c("12345", 5)) != 0xE3069283) return 1;
+
+    // Chemin logiciel forcé (celui de l'ESP32-S3) : vecteurs de référence,
+    // toutes longueurs et alignements face au calcul bit à bit, puis une
+    // image de plusieurs enregistrements encodée et validée sous ce chemin
+    {
+        auto crc32c_bitwise = [](const uint8_t* p, size_t size) {
+            uint32_t crc = ~0u;
+            while (size--) {
+                crc ^= *p++;
+                for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+            }
+            return ~crc;
+        };
+        std::vector<Reptile> herd(50);
+        for (size_t i = 0; i < herd.size(); i++) {
+            snprintf(herd[i].name, sizeof(herd[i].name), "C%02zu", i);
+            herd[i].species = (ReptileSpecies)(i % REPTILE_SPECIES_COUNT);
+            herd[i].health.overall_health = (uint8_t)(i * 2);
+        }
+        std::vector<uint8_t> accelerated(save_image_size(herd.size()));
+        size_t size = encode_save_image(herd.data(), herd.size(), 7, 1234, accelerated.data(), accelerated.size());
+        if (!size) return 1;
+
+        crc32c_force_software(true);
+        if (crc32c("123456789", 9) != 0xE3069283) return 1;
+        if (crc32c("6789", 4, crc32c("12345", 5)) != 0xE3069283) return 1;
+        uint8_t bytes[80];
+        for (size_t i = 0; i < sizeof(bytes); i++) bytes[i] = (uint8_t)(i * 37 + 11);
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t len = 0; len + offset <= 72; len++) {
+                if (crc32c(bytes + offset, len) != crc32c_bitwise(bytes + offset, len)) return 1;
+            }
+        }
+        std::vector<uint8_t> software(accelerated.size());
+        if (encode_save_image(herd.data(), herd.size(), 7, 1234, software.data(), software.size()) != size) return 1;
+        if (memcmp(software.data(), accelerated.data(), size) != 0) return 1;
+        SaveImageView view;
+        if (!view.open(software.data(), size) || view.count_valid_records() != herd.size()) return 1;
+        software[save_record_offset(17) + 3] ^= 0x40;
+        if (!view.open(software.data(), size) || view.count_valid_records() != herd.size() - 1) return 1;
+        crc32c_force_software(false);
+    }
+
+    // Histogramme logarithmique : percentiles à la borne haute du seau
+    {
+        LogHistogram histogram;
+        for (uint32_t i = 1; i <= 100; i++) histogram.record(i * 10);
+        if (histogram.count() != 100 || histogram.max() != 1000) return 1;
+        if (histogram.percentile(50) != 512) return 1;
+        if (histogram.percentile(99) != 1000) return 1;
+    }
+
+    // Télémétrie d'E/S sur la NVS en mémoire
+    {
+        GameEngine engine;
+        engine.add_reptile(ReptileSpecies::CORN_SNAKE, "Gamma");
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.save_game_data()) return 1;
+        if (!saves.save_game_data()) return 1;
+        saves.log_io_report();
+
+        const SaveTelemetry& telemetry = saves.get_telemetry();
+        for (uint8_t p = 0; p < SAVE_PHASE_COUNT; p++) {
+            if (telemetry.phase((SavePhase)p).count() != 2) return 1;
+        }
+        if (telemetry.phase(SAVE_PHASE_WRITE).max() == 0) return 1;
+        const SaveTelemetry::KeyBytes* version = telemetry.find_key("save_ver");
+        if (!version || version->writes < 2 || version->bytes != version->writes * sizeof(uint32_t)) return 1;
+        const SaveTelemetry::KeyBytes* image = telemetry.find_key(SaveTelemetry::KEY_IMAGE);
+        if (!image || image->last_size != save_image_size(1)) return 1;
+        if (saves.get_save_statistics().save_data_size <= image->last_size) return 1;
+        const nvs_stats_t* usage = telemetry.get_nvs_usage();
+        if (!usage || usage->used_entries == 0 || usage->used_entries > usage->total_entries) return 1;
+    }
+    std::remove(IMAGE_PATH);
+    nvs_stub_store().clear();
+
+    // Sections de composant : une seule image, vues zéro copie au chargement
+    struct TestCounters {
+        uint32_t visits;
+        uint32_t score;
+    };
+    uint32_t treatments = 0;
+    {
+        GameEngine engine;
+        engine.add_reptile(ReptileSpecies::CORN_SNAKE, "Delta");
+        PodSection<TestCounters> counters(0x20, "test");
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.register_section(&counters) || !saves.register_section(&health_persistence())) return 1;
+        if (saves.register_section(&counters)) return 1; // Identifiant déjà pris
+
+        counters.edit().visits = 7;
+        if (!engine.treat_health_issue(0, "soin")) return 1;
+        treatments = health_state().treatments;
+        if (!saves.save_game_data()) return 1;
+        if (saves.get_save_statistics().last_save_sections != 2 || counters.is_dirty()) return 1;
+        if (nvs_stub_store().size() > 4) return 1; // Aucune clé NVS par composant
+    }
+    {
+        GameEngine engine;
+        PodSection<TestCounters> counters(0x20, "test");
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        saves.register_section(&counters);
+        saves.register_section(&health_persistence());
+        if (!saves.load_game_data()) return 1;
+        if (!counters.is_attached() || counters.get().visits != 7) return 1;
+        if (health_state().treatments != treatments) return 1;
+
+        // Section modifiée seule : sauvegarde malgré des reptiles encore projetés
+        if (!saves.save_game_data() || saves.get_save_statistics().total_saves != 0) return 1;
+        counters.edit().score = 3;
+        if (!saves.save_game_data() || saves.get_save_statistics().total_saves != 1) return 1;
+    }
+    {
+        GameEngine engine;
+        PodSection<TestCounters> counters(0x20, "test");
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        saves.register_section(&counters);
+        if (!saves.load_game_data()) return 1;
+        if (counters.get().visits != 7 || counters.get().score != 3) return 1;
+    }
+    std::remove(IMAGE_PATH);
+    nvs_stub_store().clear();
+
+    // Sauvegarde puis rechargement projeté
+    {
+        GameEngine engine;
+        engine.add_reptile(ReptileSpecies::POGONA_VITTICEPS, "Alpha");
+        engine.add_reptile(ReptileSpecies::LEOPARD_GECKO, "Beta");
+        engine.get_reptile(1)->experience_points = 42;
+
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.save_game_data()) return 1;
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+
+        // Lecture en place, sans copie
+        if (!engine.has_mapped_reptiles()) return 1;
+        if (engine.get_reptile_count() != 2) return 1;
+        if (strcmp(engine.peek_reptile(0)->name, "Alpha") != 0) return 1;
+        if (engine.get_total_experience() != 42) return 1;
+
+        // Image inchangée : aucune écriture
+        if (!saves.save_game_data()) return 1;
+        if (saves.get_save_statistics().total_saves != 0) return 1;
+
+        // Première écriture : copie en RAM puis sauvegarde dans l'autre slot
+        if (!engine.handle_reptile(0)) return 1;
+        if (engine.has_mapped_reptiles()) return 1;
+        if (!saves.save_game_data()) return 1;
+        if (!saves.backup_save()) return 1;
+    }
+
+    // Un enregistrement corrompu n'invalide pas les autres
+    {
+        uint8_t slot = 0;
+        size_t size = sizeof(slot);
+        if (nvs_get_blob(0, "save_slot", &slot, &size) != ESP_OK) return 1;
+
+        SavePartition partition;
+        if (!partition.open()) return 1;
+        SaveImageView view;
+        if (!view.open(partition.map_slot(slot), SavePartition::SLOT_SIZE)) return 1;
+        size_t offset = view.reptile_records() - partition.map_slot(slot) + 4;
+        uint8_t byte = view.reptile_records()[4] ^ 0x5A;
+        if (!partition.write(slot, offset, &byte, 1)) return 1;
+        if (view.count_valid_records() != 1) return 1;
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        if (engine.get_reptile_count() != 1) return 1;
+        if (strcmp(engine.peek_reptile(0)->name, "Beta") != 0) return 1;
+        if (saves.get_save_statistics().dropped_records != 1) return 1;
+    }
+
+    // Sauvegarde en flux bien au-delà de l'ancien tampon de 4 Ko
+    {
+        GameEngine engine;
+        std::vector<Reptile> many(200);
+        for (size_t i = 0; i < many.size(); i++) {
+            snprintf(many[i].name, sizeof(many[i].name), "R%zu", i);
+        }
+        engine.set_reptiles(many);
+
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.save_game_data()) return 1;
+        SaveSystem::SaveStats stats = saves.get_save_statistics();
+        if (stats.last_save_segments < 50) return 1;
+        if (stats.stream_buffer_bytes != SaveStreamWriter::buffer_bytes()) return 1;
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        if (engine.get_reptile_count() != 200) return 1;
+        if (strcmp(engine.peek_reptile(199)->name, "R199") != 0) return 1;
+    }
+
+    // Sauvegarde d'urgence depuis le tampon préencodé, reprise au chargement
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        saves.refresh_emergency_image();
+        if (saves.get_save_statistics().warm_records_updated != 200) return 1;
+
+        strcpy(engine.get_reptile(3)->name, "Urgence");
+        saves.refresh_emergency_image();
+        saves.emergency_save();
+        SaveSystem::SaveStats stats = saves.get_save_statistics();
+        if (stats.warm_records_updated != 201) return 1;
+        if (stats.emergency_saves != 1 || stats.emergency_buffer_bytes != SavePartition::SLOT_SIZE) return 1;
+
+        // Alerte répétée sans changement : pas de nouvel effacement
+        saves.refresh_emergency_image();
+        saves.emergency_save();
+        stats = saves.get_save_statistics();
+        if (stats.emergency_saves != 1 || stats.emergency_skipped != 1) return 1;
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        if (engine.get_reptile_count() != 200) return 1;
+        if (strcmp(engine.peek_reptile(3)->name, "Urgence") != 0) return 1;
+    }
+
+    // Migration d'un blob v1 présent en NVS
+    std::remove(IMAGE_PATH);
+    nvs_stub_store().clear();
+    {
+        GameEngine source;
+        source.add_reptile(ReptileSpecies::CORN_SNAKE, "Legacy");
+        const Reptile& reptile = source.get_reptiles()[0];
+
+        LegacySaveHeader header = {};
+        header.version = SAVE_FORMAT_LEGACY;
+        header.reptile_count = 1;
+        header.checksum = save_checksum(reinterpret_cast<const uint8_t*>(&reptile), sizeof(Reptile));
+        std::vector<uint8_t> blob(sizeof(header) + sizeof(Reptile));
+        memcpy(blob.data(), &header, sizeof(header));
+        memcpy(blob.data() + sizeof(header), &reptile, sizeof(Reptile));
+
+        uint32_t version = SAVE_FORMAT_LEGACY;
+        nvs_set_blob(0, "save_ver", &version, sizeof(version));
+        nvs_set_blob(0, "reptile_data", blob.data(), blob.size());
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        if (engine.get_reptile_count() != 1) return 1;
+        size_t size = 0;
+        if (nvs_get_blob(0, "reptile_data", nullptr, &size) != ESP_ERR_NVS_NOT_FOUND) return 1;
+    }
+    {
+        GameEngine engine;
+        SaveSystem saves(&engine);
+        if (!saves.initialize()) return 1;
+        if (!saves.load_game_data()) return 1;
+        if (strcmp(engine.peek_reptile(0)->name, "Legacy") != 0) return 1;
+    }
+
+    std::remove(IMAGE_PATH);
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include "screen_cache.h"
+#include <iostream>
+
+int main() {
+    ScreenCache cache(7, 100);
+    cache.record_build(0, 40, 900);
+    cache.pin(0);
+
+    // Premier affichage : empreinte inconnue, rien à évincer
+    if (cache.next_victim(1, 0) != ScreenCache::NONE) return 1;
+    cache.record_build(1, 30, 500);
+    cache.record_build(2, 30, 400);
+    if (cache.resident_bytes() != 100 || cache.resident_count() != 3) return 1;
+
+    // Écran 1 réaffiché : l'écran 2 devient le moins récemment utilisé
+    cache.touch(1);
+    cache.record_build(3, 25, 300);
+    int8_t victim = cache.next_victim(3, 3);
+    if (victim != 2) return 1;
+    cache.record_eviction(2);
+    if (cache.next_victim(3, 3) != ScreenCache::NONE) return 1;
+
+    // Reconstruction : l'empreinte connue sert d'estimation avant construction
+    if (cache.next_victim(2, 3) != 1) return 1;
+    cache.record_eviction(1);
+    if (cache.next_victim(2, 3) != ScreenCache::NONE) return 1;
+    cache.record_build(2, 30, 700);
+    const ScreenCache::Entry& entry = cache.entry(2);
+    if (entry.builds != 2 || entry.evictions != 1 || entry.build_us_max != 700) return 1;
+
+    // Écran épinglé et écran courant jamais évincés, même hors budget
+    cache.set_budget(10);
+    if (cache.next_victim(3, 3) != 2) return 1;
+    cache.record_eviction(2);
+    if (cache.next_victim(3, 3) != ScreenCache::NONE) return 1;
+    if (!cache.is_built(0) || !cache.is_built(3)) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -1,3 +1,4 @@
 #pragma once
 #include <stdint.h>
-static inline uint32_t esp_random(void) { return 4; }
+// Valeur fixe, au-dessus des seuils des événements aléatoires du moteur
+static inline uint32_t esp_random(void) { return 4242; }
@@ -4,3 +4,25 @@ typedef int lv_color_t;
 typedef int lv_indev_t;
 typedef int lv_display_t;
 struct lv_area_t { int x1; int y1; int x2; int y2; };
+
+// Widgets simulés : les setters comptent les appels (coût d'invalidation)
+struct lv_obj_t {
+    char text[64];
+    int32_t value;
+    uint32_t set_calls;
+};
+#define LV_ANIM_OFF 0
+#define LV_ANIM_ON 1
+#include <cstring>
+inline void lv_label_set_text(lv_obj_t* obj, const char* text) {
+    strncpy(obj->text, text, sizeof(obj->text) - 1);
+    obj->set_calls++;
+}
+inline void lv_slider_set_value(lv_obj_t* obj, int32_t value, int /*anim*/) {
+    obj->value = value;
+    obj->set_calls++;
+}
+inline void lv_bar_set_value(lv_obj_t* obj, int32_t value, int /*anim*/) {
+    obj->value = value;
+    obj->set_calls++;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "esp_err.h"
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// NVS en mémoire pour les tests hôte
+typedef uint32_t nvs_handle_t;
+enum nvs_open_mode_t { NVS_READONLY, NVS_READWRITE };
+
+inline std::map<std::string, std::vector<uint8_t>>& nvs_stub_store() {
+    static std::map<std::string, std::vector<uint8_t>> store;
+    return store;
+}
+
+static inline esp_err_t nvs_open(const char*, nvs_open_mode_t, nvs_handle_t* handle) {
+    *handle = 1;
+    return ESP_OK;
+}
+static inline void nvs_close(nvs_handle_t) {}
+static inline esp_err_t nvs_commit(nvs_handle_t) { return ESP_OK; }
+
+static inline esp_err_t nvs_set_blob(nvs_handle_t, const char* key, const void* value, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    nvs_stub_store()[key].assign(bytes, bytes + length);
+    return ESP_OK;
+}
+
+static inline esp_err_t nvs_get_blob(nvs_handle_t, const char* key, void* out_value, size_t* length) {
+    auto it = nvs_stub_store().find(key);
+    if (it == nvs_stub_store().end()) return ESP_ERR_NVS_NOT_FOUND;
+    if (out_value) {
+        if (*length < it->second.size()) return ESP_ERR_NVS_INVALID_LENGTH;
+        memcpy(out_value, it->second.data(), it->second.size());
+    }
+    *length = it->second.size();
+    return ESP_OK;
+}
+
+static inline esp_err_t nvs_erase_key(nvs_handle_t, const char* key) {
+    return nvs_stub_store().erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+static inline esp_err_t nvs_erase_all(nvs_handle_t) {
+    nvs_stub_store().clear();
+    return ESP_OK;
+}
+
+// Occupation estimée comme sur cible : un blob = index + en-tête + données par entrées de 32 octets
+typedef struct {
+    size_t used_entries;
+    size_t free_entries;
+    size_t available_entries;
+    size_t total_entries;
+    size_t namespace_count;
+} nvs_stats_t;
+
+static inline esp_err_t nvs_get_stats(const char*, nvs_stats_t* stats) {
+    const size_t total = 6 * 126; // Partition de 24 Ko
+    size_t used = 1; // Espace de noms
+    for (const auto& entry : nvs_stub_store()) {
+        used += 2 + (entry.second.size() + 31) / 32;
+    }
+    stats->used_entries = used;
+    stats->free_entries = total - used;
+    stats->available_entries = total - used - 126; // Page réservée
+    stats->total_entries = total;
+    stats->namespace_count = 1;
+    return ESP_OK;
+}
@@ -0,0 +1,3 @@
+#pragma once
+#include "nvs.h"
+static inline esp_err_t nvs_flash_init(void) { return ESP_OK; }
@@ -0,0 +1,84 @@
+#include "touch_input.h"
+#include <iostream>
+
+static TouchSample one(uint32_t us, uint16_t x, uint16_t y) {
+    TouchSample s = {};
+    s.irq_us = us;
+    s.count = 1;
+    s.points[0] = {x, y, 0};
+    return s;
+}
+
+static TouchSample two(uint32_t us, uint16_t x0, uint16_t x1) {
+    TouchSample s = one(us, x0, 300);
+    s.count = 2;
+    s.points[1] = {x1, 300, 1};
+    return s;
+}
+
+static TouchSample none(uint32_t us) {
+    TouchSample s = {};
+    s.irq_us = us;
+    return s;
+}
+
+int main() {
+    // Rafale depuis TD_STATUS : deux points, coordonnées sur 12 bits et identifiant
+    uint8_t regs[FT5X06_BURST_BYTES] = {0x02,
+                                        0x83, 0xE8, 0x10, 0x64, 0, 0,
+                                        0x00, 0x0A, 0x12, 0x58, 0, 0};
+    TouchSample sample;
+    if (!ft5x06_parse(regs, 42, sample) || sample.count != 2 || sample.irq_us != 42) return 1;
+    if (sample.points[0].x != 1000 || sample.points[0].y != 100 || sample.points[0].id != 1) return 1;
+    if (sample.points[1].x != 10 || sample.points[1].y != 600) return 1;
+    regs[0] = 0xFF;
+    if (ft5x06_parse(regs, 0, sample)) return 1;
+
+    // File sans verrou : ordre conservé
+    TouchRing ring;
+    for (uint32_t i = 0; i < TouchRing::CAPACITY; i++) {
+        if (!ring.push(one(i, 0, 0))) return 1;
+    }
+    for (uint32_t i = 0; i < TouchRing::CAPACITY; i++) {
+        if (!ring.pop(sample) || sample.irq_us != i) return 1;
+    }
+    if (ring.pop(sample) || !ring.empty()) return 1;
+
+    // Pleine : la levée poussée en dernier écarte le plus ancien et reste lue
+    for (uint32_t i = 0; i < TouchRing::CAPACITY; i++) ring.push(one(i, 0, 0));
+    if (ring.push(none(99))) return 1;
+    for (uint32_t i = 1; i < TouchRing::CAPACITY; i++) {
+        if (!ring.pop(sample) || sample.irq_us != i || sample.count != 1) return 1;
+    }
+    if (!ring.pop(sample) || sample.irq_us != 99 || sample.count != 0) return 1;
+    if (ring.pop(sample) || !ring.empty()) return 1;
+
+    // Balayage vers la gauche, rapide et horizontal
+    GestureDetector detector;
+    TouchGesture gesture;
+    if (detector.feed(one(0, 400, 100), gesture)) return 1;
+    if (detector.feed(one(100000, 300, 110), gesture)) return 1;
+    if (detector.feed(one(200000, 200, 115), gesture)) return 1;
+    if (!detector.feed(none(250000), gesture) || gesture.type != GestureType::SWIPE_LEFT) return 1;
+    if (gesture.start_x != 400 || gesture.start_y != 100) return 1;
+
+    // Trop lent ou trop court : pas de geste
+    detector.feed(one(0, 400, 100), gesture);
+    detector.feed(one(900000, 100, 100), gesture);
+    if (detector.feed(none(1000000), gesture)) return 1;
+    detector.feed(one(0, 400, 100), gesture);
+    detector.feed(one(50000, 350, 100), gesture);
+    if (detector.feed(none(60000), gesture)) return 1;
+
+    // Pincement : un geste par palier de 15 %, pas de balayage à la levée
+    if (detector.feed(two(0, 400, 600), gesture)) return 1;
+    if (detector.feed(two(10000, 390, 610), gesture)) return 1;
+    if (!detector.feed(two(20000, 350, 650), gesture) || gesture.type != GestureType::PINCH) return 1;
+    if (gesture.scale_permille != 1500 || gesture.start_x != 500) return 1;
+    if (!detector.feed(two(30000, 425, 575), gesture) || gesture.scale_permille != 500) return 1;
+    if (detector.feed(one(40000, 100, 300), gesture)) return 1;
+    if (detector.feed(none(50000), gesture)) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
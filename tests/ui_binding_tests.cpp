@@ -0,0 +1,62 @@
+#include "ui_binding.h"
+#include <cinttypes>
+#include <cstring>
+#include <iostream>
+
+int main() {
+    lv_obj_t label = {};
+    lv_obj_t slider = {};
+    lv_obj_t bar = {};
+    lv_obj_t behavior = {};
+
+    UIBindings bindings;
+    int8_t temp_label = bindings.bind_label(&label, "T: %" PRId32 "C");
+    int8_t temp_slider = bindings.bind_slider(&slider);
+    int8_t health = bindings.bind_bar(&bar, 5.0f);
+    int8_t icon = bindings.bind_text(&behavior);
+    if (temp_label < 0 || temp_slider < 0 || health < 0 || icon < 0) return 1;
+    if (bindings.bind_slider(nullptr) != UIBindings::INVALID) return 1;
+
+    // Première valeur toujours appliquée
+    if (!bindings.set(temp_label, 29.6f) || strcmp(label.text, "T: 30C") != 0) return 1;
+    if (!bindings.set(temp_slider, 29.6f) || slider.value != 30) return 1;
+
+    // 30 images identiques à l'arrêt : aucun appel LVGL
+    for (int frame = 0; frame < 30; frame++) {
+        bindings.set(temp_label, 29.6f);
+        bindings.set(temp_slider, 29.6f);
+    }
+    if (label.set_calls != 1 || slider.set_calls != 1) return 1;
+    if (bindings.get_stats().skipped != 60) return 1;
+
+    // Hystérésis autour du demi-pas, puis vrai changement
+    if (bindings.set(temp_label, 30.55f) || label.set_calls != 1) return 1;
+    if (!bindings.set(temp_label, 30.7f) || strcmp(label.text, "T: 31C") != 0) return 1;
+    if (bindings.set(temp_label, 30.45f)) return 1;
+    if (!bindings.set(temp_label, 30.3f) || strcmp(label.text, "T: 30C") != 0) return 1;
+
+    // Pas de 5 % : les petites variations restent invisibles
+    bindings.set(health, 72.0f);
+    if (bar.value != 70) return 1;
+    bindings.set(health, 72.9f);
+    bindings.set(health, 68.0f);
+    if (bar.set_calls != 1) return 1;
+    if (!bindings.set(health, 76.0f) || bar.value != 75) return 1;
+
+    // Invalidation après un geste utilisateur : resynchronisation forcée
+    slider.value = 40;
+    bindings.invalidate(temp_slider);
+    if (!bindings.set(temp_slider, 29.6f) || slider.value != 30) return 1;
+
+    // Texte constant : comparaison de pointeurs
+    static const char* BASKING = "Basking";
+    static const char* SLEEPING = "Dort";
+    bindings.set_text(icon, BASKING);
+    bindings.set_text(icon, BASKING);
+    bindings.set_text(icon, SLEEPING);
+    if (behavior.set_calls != 2 || strcmp(behavior.text, "Dort") != 0) return 1;
+    if (bindings.set(icon, 1.0f) || bindings.set_text(temp_label, BASKING)) return 1;
+
+    std::cout << "OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include "nvs_dump.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+static constexpr size_t PAGE_SIZE = 4096;
+static constexpr size_t ENTRY_SIZE = 32;
+static constexpr size_t ENTRY_COUNT = 126;
+static constexpr size_t ENTRIES_OFFSET = 64;
+static constexpr size_t BITMAP_OFFSET = 32;
+
+static constexpr uint32_t PAGE_ACTIVE = 0xFFFFFFFE;
+static constexpr uint32_t PAGE_FULL = 0xFFFFFFFC;
+static constexpr uint32_t PAGE_FREEING = 0xFFFFFFF8;
+
+static constexpr uint8_t ENTRY_WRITTEN = 2;
+
+static constexpr uint8_t TYPE_SZ = 0x21;
+static constexpr uint8_t TYPE_BLOB = 0x41;
+static constexpr uint8_t TYPE_BLOB_DATA = 0x42;
+static constexpr uint8_t TYPE_BLOB_IDX = 0x48;
+
+struct NvsItem {
+    uint8_t ns_index;
+    uint8_t type;
+    uint8_t span;
+    uint8_t chunk_index;
+    uint32_t crc;
+    char key[16];
+    uint8_t data[8];
+};
+static_assert(sizeof(NvsItem) == ENTRY_SIZE, "Entrée NVS de 32 octets");
+
+static uint32_t read_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Taille des types entiers NVS (u8/i8 ... u64/i64), 0 pour un autre type
+static size_t integer_size(uint8_t type) {
+    switch (type) {
+        case 0x01: case 0x11: return 1;
+        case 0x02: case 0x12: return 2;
+        case 0x04: case 0x14: return 4;
+        case 0x08: case 0x18: return 8;
+        default: return 0;
+    }
+}
+
+static uint16_t read_u16(const uint8_t* p) {
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static bool page_in_use(uint32_t state) {
+    return state == PAGE_ACTIVE || state == PAGE_FULL || state == PAGE_FREEING;
+}
+
+static uint8_t entry_state(const uint8_t* page, size_t index) {
+    uint32_t word = read_u32(page + BITMAP_OFFSET + (index / 16) * 4);
+    return (word >> ((index % 16) * 2)) & 0x3;
+}
+
+bool nvs_looks_like_dump(const uint8_t* data, size_t size) {
+    if (size < PAGE_SIZE || size % PAGE_SIZE != 0) return false;
+    bool any_used = false;
+    for (size_t off = 0; off < size; off += PAGE_SIZE) {
+        uint32_t state = read_u32(data + off);
+        if (state == 0xFFFFFFFF) continue;
+        if (!page_in_use(state) && state != 0xFFFFFFF0) return false;
+        uint8_t version = data[off + 8];
+        if (version != 0xFE && version != 0xFF) return false;
+        any_used = true;
+    }
+    return any_used;
+}
+
+bool nvs_parse_dump(const uint8_t* data, size_t size, std::vector<NvsEntry>& entries) {
+    entries.clear();
+    if (!nvs_looks_like_dump(data, size)) return false;
+
+    // Pages dans l'ordre d'écriture (numéro de séquence)
+    std::vector<const uint8_t*> pages;
+    for (size_t off = 0; off < size; off += PAGE_SIZE) {
+        if (page_in_use(read_u32(data + off))) pages.push_back(data + off);
+    }
+    std::sort(pages.begin(), pages.end(), [](const uint8_t* a, const uint8_t* b) {
+        return read_u32(a + 4) < read_u32(b + 4);
+    });
+
+    std::map<uint8_t, std::string> namespaces;
+    struct Blob {
+        uint32_t size = 0;
+        uint8_t chunk_count = 0;
+        uint8_t chunk_start = 0;
+        bool indexed = false;
+        std::map<uint8_t, std::vector<uint8_t>> chunks;
+    };
+    std::map<std::pair<uint8_t, std::string>, NvsEntry> values;
+    std::map<std::pair<uint8_t, std::string>, Blob> blobs;
+
+    for (const uint8_t* page : pages) {
+        for (size_t i = 0; i < ENTRY_COUNT; i++) {
+            if (entry_state(page, i) != ENTRY_WRITTEN) continue;
+            NvsItem item;
+            memcpy(&item, page + ENTRIES_OFFSET + i * ENTRY_SIZE, sizeof(item));
+            if (item.span == 0 || i + item.span > ENTRY_COUNT) continue;
+
+            std::string key(item.key, strnlen(item.key, sizeof(item.key)));
+            if (item.ns_index == 0) {
+                namespaces[item.data[0]] = key; // Déclaration d'espace de noms
+                continue;
+            }
+
+            auto id = std::make_pair(item.ns_index, key);
+            const uint8_t* payload = page + ENTRIES_OFFSET + (i + 1) * ENTRY_SIZE;
+            size_t payload_max = (item.span - 1) * ENTRY_SIZE;
+
+            if (item.type == TYPE_BLOB_IDX) {
+                Blob& blob = blobs[id];
+                blob.size = read_u32(item.data);
+                blob.chunk_count = item.data[4];
+                blob.chunk_start = item.data[5];
+                blob.indexed = true;
+            } else if (item.type == TYPE_BLOB_DATA) {
+                size_t len = std::min<size_t>(read_u16(item.data), payload_max);
+                blobs[id].chunks[item.chunk_index].assign(payload, payload + len);
+            } else if (item.type == TYPE_SZ || item.type == TYPE_BLOB) {
+                size_t len = std::min<size_t>(read_u16(item.data), payload_max);
+                NvsEntry& entry = values[id];
+                entry.type = item.type;
+                entry.value.assign(payload, payload + len);
+            } else {
+                // Types entiers : valeur dans les 8 octets de données ; un
+                // type inconnu est signalé sans lire au-delà de `data`
+                NvsEntry& entry = values[id];
+                entry.type = item.type;
+                size_t len = integer_size(item.type);
+                entry.malformed = len == 0;
+                entry.value.assign(item.data, item.data + len);
+            }
+            i += item.span - 1;
+        }
+    }
+
+    // Réassemblage des blobs découpés en fragments
+    for (auto& it : blobs) {
+        Blob& blob = it.second;
+        if (!blob.indexed) continue;
+        NvsEntry& entry = values[it.first];
+        entry.type = TYPE_BLOB_IDX;
+        entry.value.clear();
+        for (uint8_t c = 0; c < blob.chunk_count; c++) {
+            auto chunk = blob.chunks.find(blob.chunk_start + c);
+            if (chunk == blob.chunks.end()) break;
+            entry.value.insert(entry.value.end(), chunk->second.begin(), chunk->second.end());
+        }
+        if (entry.value.size() != blob.size) {
+            entry.value.clear(); // Blob incomplet
+        }
+    }
+
+    for (auto& it : values) {
+        NvsEntry entry = it.second;
+        entry.ns = namespaces.count(it.first.first) ? namespaces[it.first.first] : "?";
+        entry.key = it.first.second;
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+const NvsEntry* nvs_find(const std::vector<NvsEntry>& entries, const char* ns, const char* key) {
+    for (const NvsEntry& entry : entries) {
+        if (entry.key == key && (!ns || entry.ns == ns)) return &entry;
+    }
+    return nullptr;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Lecture hors ligne d'un vidage de partition NVS (format de pages ESP-IDF) :
+// pages de 4 Ko, en-tête de 32 octets, bitmap d'état, 126 entrées de 32 octets.
+// Les CRC internes de la NVS ne sont pas vérifiés ; seules les entrées
+// à l'état "écrit" sont retenues.
+
+struct NvsEntry {
+    std::string ns;
+    std::string key;
+    uint8_t type;                   // Type d'élément NVS (0x04 = u32, 0x48 = index de blob...)
+    std::vector<uint8_t> value;
+    bool malformed = false;         // Type inconnu : valeur non lue
+};
+
+// Vrai si les premières pages portent un en-tête NVS plausible
+bool nvs_looks_like_dump(const uint8_t* data, size_t size);
+
+bool nvs_parse_dump(const uint8_t* data, size_t size, std::vector<NvsEntry>& entries);
+
+const NvsEntry* nvs_find(const std::vector<NvsEntry>& entries, const char* ns, const char* key);
@@ -0,0 +1,649 @@
+// Outil hôte pour les sauvegardes : décodage de vidages (partition "savedata",
+// image de slot, partition NVS, blob v1), vérification des sommes de contrôle,
+// migration en masse vers le format courant et banc d'essai de débit.
+// Compilé avec le code de sérialisation du firmware (save_format.cpp, crc32c.cpp).
+
+#include "nvs_dump.h"
+#include "save_format.h"
+#include "save_partition.h"
+#include "species_database.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const char* NVS_NAMESPACE = "reptile_game";
+static const char* SLOT_NAMES[SavePartition::SLOT_COUNT] = { "A", "B", "secours", "urgence" };
+
+struct Options {
+    bool json = false;
+    const char* out_dir = nullptr;
+    size_t saves = 5000;
+    size_t reptiles = 10;
+    std::vector<const char*> files;
+};
+
+// ---------------------------------------------------------------------------
+// Sortie JSON minimale (objets et tableaux imbriqués, chaînes échappées)
+
+class JsonOut {
+private:
+    std::string buffer;
+    std::vector<bool> first;
+
+    void separator() {
+        if (!first.empty()) {
+            if (!first.back()) buffer += ',';
+            first.back() = false;
+        }
+    }
+    void key(const char* k) {
+        separator();
+        if (k) {
+            string_value(k);
+            buffer += ':';
+        }
+    }
+    void string_value(const char* s) {
+        buffer += '"';
+        for (const char* p = s; *p; p++) {
+            unsigned char c = *p;
+            if (c == '"' || c == '\\') {
+                buffer += '\\';
+                buffer += c;
+            } else if (c < 0x20) {
+                char esc[8];
+                snprintf(esc, sizeof(esc), "\\u%04x", c);
+                buffer += esc;
+            } else {
+                buffer += c;
+            }
+        }
+        buffer += '"';
+    }
+
+public:
+    void begin_object(const char* k = nullptr) { key(k); buffer += '{'; first.push_back(true); }
+    void end_object() { buffer += '}'; first.pop_back(); }
+    void begin_array(const char* k = nullptr) { key(k); buffer += '['; first.push_back(true); }
+    void end_array() { buffer += ']'; first.pop_back(); }
+    void field(const char* k, const char* v) { key(k); string_value(v); }
+    void field(const char* k, const std::string& v) { field(k, v.c_str()); }
+    void field(const char* k, bool v) { key(k); buffer += v ? "true" : "false"; }
+    void field(const char* k, uint64_t v) { key(k); buffer += std::to_string(v); }
+    void field(const char* k, uint32_t v) { field(k, (uint64_t)v); }
+    void field(const char* k, int v) { key(k); buffer += std::to_string(v); }
+    void field(const char* k, double v) {
+        char text[32];
+        snprintf(text, sizeof(text), "%.6g", v);
+        key(k);
+        buffer += text;
+    }
+    void print() const { printf("%s\n", buffer.c_str()); }
+};
+
+// ---------------------------------------------------------------------------
+// Lecture des fichiers et détection du type de vidage
+
+static bool read_file(const char* path, std::vector<uint8_t>& data) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data.resize(size > 0 ? size : 0);
+    bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok;
+}
+
+static bool write_file(const std::string& path, const uint8_t* data, size_t size) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, size, f) == size;
+    fclose(f);
+    return ok;
+}
+
+enum DumpKind { DUMP_UNKNOWN, DUMP_PARTITION, DUMP_IMAGE, DUMP_NVS, DUMP_LEGACY_BLOB };
+
+static const char* dump_kind_name(DumpKind kind) {
+    switch (kind) {
+        case DUMP_PARTITION: return "partition";
+        case DUMP_IMAGE: return "image";
+        case DUMP_NVS: return "nvs";
+        case DUMP_LEGACY_BLOB: return "blob_v1";
+        default: return "inconnu";
+    }
+}
+
+static DumpKind detect_kind(const std::vector<uint8_t>& data) {
+    uint32_t magic = 0;
+    if (data.size() >= sizeof(magic)) memcpy(&magic, data.data(), sizeof(magic));
+    if (data.size() >= SavePartition::SLOT_SIZE * SavePartition::SLOT_COUNT) return DUMP_PARTITION;
+    if (magic == SAVE_IMAGE_MAGIC) return DUMP_IMAGE;
+    if (nvs_looks_like_dump(data.data(), data.size())) return DUMP_NVS;
+    if (data.size() >= sizeof(LegacySaveHeader) && magic == SAVE_FORMAT_LEGACY) return DUMP_LEGACY_BLOB;
+    return DUMP_UNKNOWN;
+}
+
+// ---------------------------------------------------------------------------
+// Rapport d'une image (slot)
+
+struct ImageReport {
+    bool present = false;           // Magic trouvé
+    bool header_valid = false;
+    uint16_t version = 0;
+    uint32_t sequence = 0;
+    uint32_t image_size = 0;
+    size_t records = 0;
+    size_t invalid_records = 0;
+    size_t sections = 0;
+    size_t invalid_sections = 0;
+};
+
+static ImageReport inspect_image(const uint8_t* data, size_t size, SaveImageView& view) {
+    ImageReport report;
+    uint32_t magic = 0;
+    if (size >= sizeof(magic)) memcpy(&magic, data, sizeof(magic));
+    report.present = magic == SAVE_IMAGE_MAGIC;
+    if (!report.present || !view.open(data, size)) return report;
+
+    report.header_valid = true;
+    report.version = view.header()->version;
+    report.sequence = view.header()->sequence;
+    report.image_size = view.header()->image_size;
+    report.records = view.reptile_count();
+    report.invalid_records = report.records - view.count_valid_records();
+    report.sections = view.section_count();
+    for (uint16_t i = 0; i < view.section_count(); i++) {
+        const SaveSectionEntry* section = view.section_at(i);
+        if (section->record_stride == 0 && !view.section_valid(*section)) report.invalid_sections++;
+    }
+    return report;
+}
+
+static void print_reptile(JsonOut* json, const Reptile& reptile, bool valid) {
+    char name[sizeof(reptile.name) + 1] = {};
+    memcpy(name, reptile.name, sizeof(reptile.name));
+    const char* species = (uint8_t)reptile.species < REPTILE_SPECIES_COUNT ? get_species_data(reptile.species).scientific_name : "?";
+    if (json) {
+        json->begin_object();
+        json->field("name", name);
+        json->field("species", species);
+        json->field("health", (uint32_t)reptile.health.overall_health);
+        json->field("age_days", (uint32_t)reptile.age_days);
+        json->field("experience", reptile.experience_points);
+        json->field("valid", valid);
+        json->end_object();
+    } else {
+        printf("    %-16s %-24s santé=%3u âge=%5u j xp=%u%s\n", name, species,
+               reptile.health.overall_health, reptile.age_days, reptile.experience_points,
+               valid ? "" : "  [CRC INVALIDE]");
+    }
+}
+
+static void print_image(JsonOut* json, const char* label, const uint8_t* data, size_t size,
+                        bool list_records, ImageReport& report) {
+    SaveImageView view;
+    report = inspect_image(data, size, view);
+
+    if (json) {
+        json->begin_object();
+        json->field("slot", label);
+        json->field("present", report.present);
+        if (report.present) {
+            json->field("header_valid", report.header_valid);
+            json->field("version", (uint32_t)report.version);
+            json->field("sequence", report.sequence);
+            json->field("image_size", report.image_size);
+            json->field("records", (uint64_t)report.records);
+            json->field("invalid_records", (uint64_t)report.invalid_records);
+            json->field("sections", (uint64_t)report.sections);
+            json->field("invalid_sections", (uint64_t)report.invalid_sections);
+        }
+        if (list_records && report.header_valid) {
+            json->begin_array("reptiles");
+            for (size_t i = 0; i < view.reptile_count(); i++) {
+                print_reptile(json, *view.reptile(i), view.record_valid(i));
+            }
+            json->end_array();
+        }
+        json->end_object();
+        return;
+    }
+
+    if (!report.present) {
+        printf("  slot %-8s vide\n", label);
+        return;
+    }
+    if (!report.header_valid) {
+        printf("  slot %-8s EN-TÊTE INVALIDE\n", label);
+        return;
+    }
+    printf("  slot %-8s v%u séquence=%u taille=%u reptiles=%zu (invalides: %zu) sections=%zu (invalides: %zu)\n",
+           label, report.version, report.sequence, report.image_size, report.records,
+           report.invalid_records, report.sections, report.invalid_sections);
+    if (list_records) {
+        for (size_t i = 0; i < view.reptile_count(); i++) {
+            print_reptile(nullptr, *view.reptile(i), view.record_valid(i));
+        }
+    }
+}
+
+static bool image_ok(const ImageReport& report) {
+    return !report.present ||
+           (report.header_valid && report.invalid_records == 0 && report.invalid_sections == 0);
+}
+
+// Décode et/ou vérifie un fichier ; renvoie faux si une somme de contrôle échoue
+static bool inspect_file(const char* path, bool list_records, JsonOut* json) {
+    std::vector<uint8_t> data;
+    if (!read_file(path, data)) {
+        fprintf(stderr, "%s: lecture impossible\n", path);
+        return false;
+    }
+    DumpKind kind = detect_kind(data);
+    bool ok = kind != DUMP_UNKNOWN;
+
+    if (json) {
+        json->begin_object();
+        json->field("file", path);
+        json->field("kind", dump_kind_name(kind));
+    } else {
+        printf("%s (%s, %zu octets)\n", path, dump_kind_name(kind), data.size());
+    }
+
+    ImageReport report;
+    if (kind == DUMP_PARTITION) {
+        if (json) json->begin_array("slots");
+        for (uint8_t slot = 0; slot < SavePartition::SLOT_COUNT; slot++) {
+            print_image(json, SLOT_NAMES[slot], data.data() + slot * SavePartition::SLOT_SIZE,
+                        SavePartition::SLOT_SIZE, list_records, report);
+            ok = ok && image_ok(report);
+        }
+        if (json) json->end_array();
+    } else if (kind == DUMP_IMAGE) {
+        if (json) json->begin_array("slots");
+        print_image(json, "image", data.data(), data.size(), list_records, report);
+        ok = ok && image_ok(report);
+        if (json) json->end_array();
+    } else if (kind == DUMP_NVS) {
+        std::vector<NvsEntry> entries;
+        nvs_parse_dump(data.data(), data.size(), entries);
+        if (json) json->begin_array("keys");
+        for (const NvsEntry& entry : entries) {
+            if (entry.malformed) {
+                ok = false;
+                if (json) {
+                    json->begin_object();
+                    json->field("namespace", entry.ns);
+                    json->field("key", entry.key);
+                    json->field("type", (uint32_t)entry.type);
+                    json->field("malformed", true);
+                    json->end_object();
+                } else {
+                    printf("  %s/%-16s type 0x%02X INVALIDE\n", entry.ns.c_str(), entry.key.c_str(), entry.type);
+                }
+                continue;
+            }
+            uint64_t number = 0;
+            if (entry.value.size() <= sizeof(number)) memcpy(&number, entry.value.data(), entry.value.size());
+            if (json) {
+                json->begin_object();
+                json->field("namespace", entry.ns);
+                json->field("key", entry.key);
+                json->field("size", (uint64_t)entry.value.size());
+                if (entry.value.size() <= sizeof(number)) json->field("value", number);
+                json->end_object();
+            } else {
+                printf("  %s/%-16s %4zu octets", entry.ns.c_str(), entry.key.c_str(), entry.value.size());
+                if (entry.value.size() <= sizeof(number)) printf("  = %llu", (unsigned long long)number);
+                printf("\n");
+            }
+        }
+        if (json) json->end_array();
+
+        const NvsEntry* blob = nvs_find(entries, NVS_NAMESPACE, "reptile_data");
+        if (blob) {
+            std::vector<Reptile> reptiles;
+            bool valid = decode_legacy_save(blob->value.data(), blob->value.size(), reptiles);
+            ok = ok && valid;
+            if (json) json->field("legacy_valid", valid);
+            else printf("  blob v1: %s, %zu reptiles\n", valid ? "valide" : "INVALIDE", reptiles.size());
+        }
+    } else if (kind == DUMP_LEGACY_BLOB) {
+        std::vector<Reptile> reptiles;
+        bool valid = decode_legacy_save(data.data(), data.size(), reptiles);
+        ok = ok && valid;
+        if (json) {
+            json->field("legacy_valid", valid);
+            json->begin_array("reptiles");
+        } else {
+            printf("  blob v1: %s, %zu reptiles\n", valid ? "valide" : "INVALIDE", reptiles.size());
+        }
+        if (list_records) {
+            for (const Reptile& reptile : reptiles) print_reptile(json, reptile, true);
+        }
+        if (json) json->end_array();
+    }
+
+    if (json) {
+        json->field("ok", ok);
+        json->end_object();
+    } else {
+        printf("  => %s\n", ok ? "OK" : "ÉCHEC");
+    }
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Migration vers le format courant
+
+struct MemoryImage {
+    std::vector<uint8_t> bytes;
+};
+
+static bool memory_sink(void* ctx, uint32_t, size_t offset, const uint8_t* data, size_t size) {
+    MemoryImage* image = static_cast<MemoryImage*>(ctx);
+    if (offset + size > image->bytes.size()) image->bytes.resize(offset + size, 0);
+    memcpy(image->bytes.data() + offset, data, size);
+    return true;
+}
+
+// Réencode les reptiles et recopie les sections brutes intactes (composants)
+static bool encode_current(const std::vector<Reptile>& reptiles, const SaveImageView* source,
+                           uint32_t sequence, uint32_t timestamp, MemoryImage& out) {
+    std::vector<const SaveSectionEntry*> raw;
+    if (source) {
+        for (uint16_t i = 0; i < source->section_count(); i++) {
+            const SaveSectionEntry* section = source->section_at(i);
+            if (section->id != SAVE_SECTION_REPTILES && section->record_stride == 0 &&
+                source->section_valid(*section)) {
+                raw.push_back(section);
+            }
+        }
+    }
+
+    out.bytes.clear();
+    SaveStreamWriter writer;
+    writer.begin(memory_sink, &out, 1 + raw.size());
+    writer.begin_section(SAVE_SECTION_REPTILES, save_record_stride());
+    for (const Reptile& reptile : reptiles) writer.append_reptile(reptile);
+    writer.end_section();
+    for (const SaveSectionEntry* section : raw) {
+        writer.begin_section(section->id, 0);
+        writer.append(source->section_data(*section), section->size);
+        writer.end_section();
+    }
+    return writer.finish(sequence, timestamp);
+}
+
+static std::string output_path(const char* out_dir, const char* input) {
+    const char* base = strrchr(input, '/');
+    base = base ? base + 1 : input;
+    return std::string(out_dir) + "/" + base + ".v" + std::to_string(SAVE_FORMAT_VERSION) + ".img";
+}
+
+static bool migrate_file(const char* path, const char* out_dir, JsonOut* json) {
+    std::vector<uint8_t> data;
+    if (!read_file(path, data)) {
+        fprintf(stderr, "%s: lecture impossible\n", path);
+        return false;
+    }
+
+    DumpKind kind = detect_kind(data);
+    std::vector<Reptile> reptiles;
+    SaveImageView view;
+    const SaveImageView* source = nullptr;
+    uint16_t from_version = 0;
+    uint32_t sequence = 1;
+    uint32_t timestamp = 0;
+    size_t dropped = 0;
+    bool ok = false;
+
+    if (kind == DUMP_PARTITION) {
+        // Slot primaire valide le plus récent
+        SaveImageView candidate;
+        for (uint8_t slot = SavePartition::SLOT_PRIMARY_A; slot <= SavePartition::SLOT_PRIMARY_B; slot++) {
+            if (candidate.open(data.data() + slot * SavePartition::SLOT_SIZE, SavePartition::SLOT_SIZE) &&
+                (!view.is_valid() || candidate.header()->sequence > view.header()->sequence)) {
+                view = candidate;
+            }
+        }
+        ok = view.is_valid();
+    } else if (kind == DUMP_IMAGE) {
+        ok = view.open(data.data(), data.size());
+    } else if (kind == DUMP_NVS) {
+        std::vector<NvsEntry> entries;
+        nvs_parse_dump(data.data(), data.size(), entries);
+        const NvsEntry* blob = nvs_find(entries, NVS_NAMESPACE, "reptile_data");
+        ok = blob && decode_legacy_save(blob->value.data(), blob->value.size(), reptiles);
+        from_version = SAVE_FORMAT_LEGACY;
+    } else if (kind == DUMP_LEGACY_BLOB) {
+        ok = decode_legacy_save(data.data(), data.size(), reptiles);
+        from_version = SAVE_FORMAT_LEGACY;
+    }
+
+    if (view.is_valid()) {
+        dropped = view.copy_valid_reptiles(reptiles);
+        from_version = view.header()->version;
+        sequence = view.header()->sequence;
+        timestamp = view.header()->timestamp;
+        source = &view;
+    }
+
+    MemoryImage image;
+    std::string out = output_path(out_dir, path);
+    ok = ok && encode_current(reptiles, source, sequence, timestamp, image) &&
+         write_file(out, image.bytes.data(), image.bytes.size());
+
+    if (json) {
+        json->begin_object();
+        json->field("file", path);
+        json->field("from_version", (uint32_t)from_version);
+        json->field("to_version", (uint32_t)SAVE_FORMAT_VERSION);
+        json->field("reptiles", (uint64_t)reptiles.size());
+        json->field("dropped_records", (uint64_t)dropped);
+        json->field("output", ok ? out : std::string());
+        json->field("ok", ok);
+        json->end_object();
+    } else if (ok) {
+        printf("%s: v%u -> v%u, %zu reptiles (%zu écartés) -> %s\n", path, from_version,
+               SAVE_FORMAT_VERSION, reptiles.size(), dropped, out.c_str());
+    } else {
+        printf("%s: migration impossible (%s)\n", path, dump_kind_name(kind));
+    }
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Banc d'essai : milliers de sauvegardes synthétiques
+
+static void synthetic_reptiles(std::vector<Reptile>& reptiles, size_t count, uint32_t seed) {
+    reptiles.assign(count, Reptile{});
+    for (size_t i = 0; i < count; i++) {
+        Reptile& r = reptiles[i];
+        seed = seed * 1664525u + 1013904223u;
+        r.species = static_cast<ReptileSpecies>(seed % REPTILE_SPECIES_COUNT);
+        snprintf(r.name, sizeof(r.name), "Synth%u", (unsigned)(seed >> 16));
+        r.age_days = seed % 5000;
+        r.weight_grams = 10 + seed % 600;
+        r.health.overall_health = seed % 101;
+        r.experience_points = seed >> 8;
+    }
+}
+
+// Image v2 (somme de contrôle globale) pour mesurer la migration
+static void encode_v2(const std::vector<Reptile>& reptiles, std::vector<uint8_t>& out) {
+    size_t data_offset = (sizeof(SaveImageHeader) + sizeof(SaveSectionEntry) + SAVE_IMAGE_ALIGN - 1) &
+                         ~(size_t)(SAVE_IMAGE_ALIGN - 1);
+    out.assign(data_offset + reptiles.size() * sizeof(Reptile), 0);
+    memcpy(out.data() + data_offset, reptiles.data(), reptiles.size() * sizeof(Reptile));
+
+    SaveSectionEntry section = {};
+    section.id = SAVE_SECTION_REPTILES;
+    section.record_stride = sizeof(Reptile);
+    section.offset = data_offset;
+    section.record_count = reptiles.size();
+    section.size = reptiles.size() * sizeof(Reptile);
+    memcpy(out.data() + sizeof(SaveImageHeader), &section, sizeof(section));
+
+    SaveImageHeader header = {};
+    header.magic = SAVE_IMAGE_MAGIC;
+    header.version = SAVE_FORMAT_MAPPED_V2;
+    header.header_size = sizeof(SaveImageHeader);
+    header.image_size = out.size();
+    header.sequence = 1;
+    header.section_count = 1;
+    header.checksum = save_checksum(out.data() + sizeof(header), out.size() - sizeof(header));
+    memcpy(out.data(), &header, sizeof(header));
+}
+
+struct BenchPhase {
+    const char* name;
+    double seconds = 0;
+    uint64_t bytes = 0;
+};
+
+static int run_bench(const Options& options, JsonOut* json) {
+    using Clock = std::chrono::steady_clock;
+    BenchPhase phases[4] = { { "encode" }, { "verify" }, { "decode" }, { "migrate_v2" } };
+    std::vector<Reptile> reptiles;
+    std::vector<Reptile> decoded;
+    std::vector<uint8_t> v2;
+    std::vector<uint8_t> buffer(save_image_size(options.reptiles));
+    MemoryImage migrated;
+    size_t failures = 0;
+
+    for (size_t n = 0; n < options.saves; n++) {
+        synthetic_reptiles(reptiles, options.reptiles, (uint32_t)n);
+
+        auto t0 = Clock::now();
+        size_t size = encode_save_image(reptiles.data(), reptiles.size(), n, 0, buffer.data(), buffer.size());
+        auto t1 = Clock::now();
+        SaveImageView view;
+        bool valid = size && view.open(buffer.data(), size) && view.count_valid_records() == reptiles.size();
+        auto t2 = Clock::now();
+        view.copy_valid_reptiles(decoded);
+        auto t3 = Clock::now();
+
+        encode_v2(reptiles, v2);
+        auto t4 = Clock::now();
+        SaveImageView old;
+        valid = valid && old.open(v2.data(), v2.size());
+        old.copy_valid_reptiles(decoded);
+        valid = valid && encode_current(decoded, &old, 1, 0, migrated);
+        auto t5 = Clock::now();
+
+        // Compatibilité : même contenu après migration
+        valid = valid && migrated.bytes.size() == size && memcmp(decoded.data(), reptiles.data(),
+                                                                  reptiles.size() * sizeof(Reptile)) == 0;
+        if (!valid) failures++;
+
+        phases[0].seconds += std::chrono::duration<double>(t1 - t0).count();
+        phases[1].seconds += std::chrono::duration<double>(t2 - t1).count();
+        phases[2].seconds += std::chrono::duration<double>(t3 - t2).count();
+        phases[3].seconds += std::chrono::duration<double>(t5 - t4).count();
+        phases[0].bytes += size;
+        phases[1].bytes += size;
+        phases[2].bytes += size;
+        phases[3].bytes += v2.size();
+    }
+
+    if (json) {
+        json->begin_object();
+        json->field("saves", (uint64_t)options.saves);
+        json->field("reptiles_per_save", (uint64_t)options.reptiles);
+        json->field("image_size", (uint64_t)save_image_size(options.reptiles));
+        json->field("failures", (uint64_t)failures);
+        json->begin_array("phases");
+    } else {
+        printf("%zu sauvegardes de %zu reptiles (%zu octets/image)\n", options.saves, options.reptiles,
+               save_image_size(options.reptiles));
+    }
+    for (const BenchPhase& phase : phases) {
+        double per_second = phase.seconds > 0 ? options.saves / phase.seconds : 0;
+        double mb_per_second = phase.seconds > 0 ? phase.bytes / phase.seconds / 1e6 : 0;
+        if (json) {
+            json->begin_object();
+            json->field("name", phase.name);
+            json->field("seconds", phase.seconds);
+            json->field("saves_per_second", per_second);
+            json->field("mb_per_second", mb_per_second);
+            json->end_object();
+        } else {
+            printf("  %-11s %10.0f sauvegardes/s %9.1f Mo/s\n", phase.name, per_second, mb_per_second);
+        }
+    }
+    if (json) {
+        json->end_array();
+        json->end_object();
+    } else {
+        printf("  échecs de compatibilité: %zu\n", failures);
+    }
+    return failures ? 1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+
+static void usage() {
+    fprintf(stderr,
+            "usage: save_tool decode  [--json] <fichier>...\n"
+            "       save_tool verify  [--json] <fichier>...\n"
+            "       save_tool migrate [--json] --out <dossier> <fichier>...\n"
+            "       save_tool bench   [--json] [--saves N] [--reptiles N]\n"
+            "Fichiers : vidage de la partition savedata, image de slot, partition NVS ou blob v1.\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+    const char* command = argv[1];
+    Options options;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--json")) options.json = true;
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc) options.out_dir = argv[++i];
+        else if (!strcmp(argv[i], "--saves") && i + 1 < argc) options.saves = strtoul(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--reptiles") && i + 1 < argc) options.reptiles = strtoul(argv[++i], nullptr, 10);
+        else options.files.push_back(argv[i]);
+    }
+
+    JsonOut json;
+    JsonOut* out = options.json ? &json : nullptr;
+    int status = 0;
+
+    if (!strcmp(command, "bench")) {
+        status = run_bench(options, out);
+    } else if (!strcmp(command, "decode") || !strcmp(command, "verify")) {
+        if (options.files.empty()) {
+            usage();
+            return 2;
+        }
+        if (out) out->begin_array();
+        for (const char* file : options.files) {
+            if (!inspect_file(file, !strcmp(command, "decode"), out)) status = 1;
+        }
+        if (out) out->end_array();
+    } else if (!strcmp(command, "migrate")) {
+        if (options.files.empty() || !options.out_dir) {
+            usage();
+            return 2;
+        }
+        if (out) out->begin_array();
+        for (const char* file : options.files) {
+            if (!migrate_file(file, options.out_dir, out)) status = 1;
+        }
+        if (out) out->end_array();
+    } else {
+        usage();
+        return 2;
+    }
+
+    if (out) out->print();
+    return status;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_DMA          (1 << 3)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+
+// Tas hôte unique de la taille de la PSRAM du module (8 Mo). Chaque bloc
+// porte sa taille dans un en-tête de 16 octets : la taille libre annoncée
+// baisse avec les allocations en cours, comme sur cible.
+static constexpr size_t HOST_HEAP_SIZE = 8 * 1024 * 1024;
+static constexpr size_t HOST_HEAP_HEADER = 16;
+
+inline size_t& host_heap_used() {
+    static size_t used = 0;
+    return used;
+}
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    if (size > HOST_HEAP_SIZE - host_heap_used()) return nullptr;
+    uint8_t* block = static_cast<uint8_t*>(malloc(size + HOST_HEAP_HEADER));
+    if (!block) return nullptr;
+    *reinterpret_cast<size_t*>(block) = size;
+    host_heap_used() += size;
+    return block + HOST_HEAP_HEADER;
+}
+
+static inline void heap_caps_free(void* ptr) {
+    if (!ptr) return;
+    uint8_t* block = static_cast<uint8_t*>(ptr) - HOST_HEAP_HEADER;
+    host_heap_used() -= *reinterpret_cast<size_t*>(block);
+    free(block);
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps) { return HOST_HEAP_SIZE - host_heap_used(); }
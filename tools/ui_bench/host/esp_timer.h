@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+// Horloge virtuelle avancée image par image par le banc : animations, délais
+// de notification et échantillonnage du graphique sont reproductibles
+extern int64_t bench_clock_us;
+static inline int64_t esp_timer_get_time(void) { return bench_clock_us; }
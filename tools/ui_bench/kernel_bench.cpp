@@ -0,0 +1,119 @@
+// Débit des noyaux RGB565 (Mpx/s) : boucles génériques de LVGL contre chaque
+// jeu d'instructions disponible, sur une bande de 1024 x 60 pixels (un tampon
+// de rendu du firmware) et sur des rectangles étroits typiques des glyphes.
+
+#include "rgb565_kernels.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static constexpr int32_t BAND_W = 1024;
+static constexpr int32_t BAND_H = 60;
+
+struct Shape {
+    const char* name;
+    int32_t w;
+    int32_t h;
+};
+
+enum class Kernel { FILL, FILL_OPA, FILL_MASK, BLEND, BLEND_OPA };
+
+static const char* kernel_name(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::FILL: return "remplissage";
+        case Kernel::FILL_OPA: return "remplissage opa";
+        case Kernel::FILL_MASK: return "remplissage masque";
+        case Kernel::BLEND: return "copie image";
+        case Kernel::BLEND_OPA: return "image opa";
+    }
+    return "?";
+}
+
+struct Buffers {
+    std::vector<uint16_t> dest;
+    std::vector<uint16_t> src;
+    std::vector<uint8_t> mask;
+};
+
+static void run_once(Kernel kernel, bool reference, Buffers& buf, const Shape& shape) {
+    void* d = buf.dest.data();
+    const int32_t stride = BAND_W * 2;
+    switch (kernel) {
+        case Kernel::FILL:
+            if (reference || !rgb565_fill(d, shape.w, shape.h, stride, 0x2945, nullptr, 0, 255))
+                rgb565_fill_scalar(d, shape.w, shape.h, stride, 0x2945, nullptr, 0, 255);
+            break;
+        case Kernel::FILL_OPA:
+            if (reference || !rgb565_fill(d, shape.w, shape.h, stride, 0x2945, nullptr, 0, 96))
+                rgb565_fill_scalar(d, shape.w, shape.h, stride, 0x2945, nullptr, 0, 96);
+            break;
+        case Kernel::FILL_MASK:
+            if (reference || !rgb565_fill(d, shape.w, shape.h, stride, 0xFFFF, buf.mask.data(), BAND_W, 255))
+                rgb565_fill_scalar(d, shape.w, shape.h, stride, 0xFFFF, buf.mask.data(), BAND_W, 255);
+            break;
+        case Kernel::BLEND:
+            if (reference || !rgb565_blend(d, shape.w, shape.h, stride, buf.src.data(), stride, nullptr, 0, 255))
+                rgb565_blend_scalar(d, shape.w, shape.h, stride, buf.src.data(), stride, nullptr, 0, 255);
+            break;
+        case Kernel::BLEND_OPA:
+            if (reference || !rgb565_blend(d, shape.w, shape.h, stride, buf.src.data(), stride, nullptr, 0, 160))
+                rgb565_blend_scalar(d, shape.w, shape.h, stride, buf.src.data(), stride, nullptr, 0, 160);
+            break;
+    }
+}
+
+// Meilleur de plusieurs passes d'environ 20 ms
+static double measure_mpx(Kernel kernel, bool reference, Buffers& buf, const Shape& shape) {
+    const uint64_t pixels = (uint64_t)shape.w * shape.h;
+    uint32_t iterations = (uint32_t)(2000000 / pixels) + 1;
+    double best = 0;
+    for (int pass = 0; pass < 5; pass++) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) run_once(kernel, reference, buf, shape);
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double mpx = pixels * (double)iterations / seconds / 1e6;
+        if (mpx > best) best = mpx;
+    }
+    return best;
+}
+
+int main(int argc, char**) {
+    if (argc > 1) {
+        fprintf(stderr, "usage: kernel_bench\n");
+        return 2;
+    }
+
+    Buffers buf;
+    buf.dest.assign(BAND_W * BAND_H, 0x1234);
+    buf.src.resize(BAND_W * BAND_H);
+    buf.mask.resize(BAND_W * BAND_H);
+    for (size_t i = 0; i < buf.src.size(); i++) buf.src[i] = (uint16_t)(i * 2654435761u >> 7);
+    // Masque d'antialiasing : bords partiels, intérieur plein
+    for (size_t i = 0; i < buf.mask.size(); i++) buf.mask[i] = (uint8_t)(i % 12 < 2 ? 64 * (i % 12 + 1) : 255);
+
+    const Shape shapes[] = {{"bande 1024x60", BAND_W, BAND_H}, {"glyphe 13x17", 13, 17}};
+    const Kernel kernels[] = {Kernel::FILL, Kernel::FILL_OPA, Kernel::FILL_MASK, Kernel::BLEND, Kernel::BLEND_OPA};
+    const rgb565_isa_t detected = rgb565_get_isa();
+    const rgb565_isa_t levels[] = {RGB565_ISA_SSE2, RGB565_ISA_AVX2, RGB565_ISA_PIE};
+
+    printf("kernel_bench: jeu détecté %s, Mpx/s (meilleure de 5 passes)\n", rgb565_isa_name(detected));
+    for (const Shape& shape : shapes) {
+        printf("%s\n", shape.name);
+        for (Kernel kernel : kernels) {
+            double reference = measure_mpx(kernel, true, buf, shape);
+            printf("  %-20s générique %8.0f", kernel_name(kernel), reference);
+            for (rgb565_isa_t isa : levels) {
+                rgb565_force_isa(isa);
+                if (rgb565_get_isa() != isa) continue;
+                double mpx = measure_mpx(kernel, false, buf, shape);
+                printf("  %s %8.0f (x%.1f)", rgb565_isa_name(isa), mpx, mpx / reference);
+            }
+            printf("\n");
+            rgb565_force_isa(detected);
+        }
+    }
+    return 0;
+}
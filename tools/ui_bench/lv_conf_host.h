@@ -0,0 +1,21 @@
+#pragma once
+// Configuration du firmware, avec l'allocateur intégré de LVGL pour que
+// lv_mem_monitor() donne le pic d'occupation du tas LVGL
+#include "../../components/lvgl/lv_conf.h"
+
+#undef LV_USE_STDLIB_MALLOC
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#undef LV_MEM_SIZE
+#define LV_MEM_SIZE             (16 * 1024 * 1024U)
+#undef LV_USE_LOG
+#define LV_USE_LOG              0
+
+// Threads de dessin POSIX à la place du portage FreeRTOS ; nombre d'unités
+// choisi à la configuration (-DUI_BENCH_DRAW_UNITS=1 pour comparer)
+#undef LV_USE_OS
+#define LV_USE_OS               LV_OS_PTHREAD
+#undef LV_OS_CUSTOM_INCLUDE
+#ifdef UI_BENCH_DRAW_UNITS
+#undef LV_DRAW_SW_DRAW_UNIT_CNT
+#define LV_DRAW_SW_DRAW_UNIT_CNT UI_BENCH_DRAW_UNITS
+#endif
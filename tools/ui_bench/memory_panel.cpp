@@ -0,0 +1,57 @@
+#include "memory_panel.h"
+#include "dirty_plan_lvgl.h"
+#include <cstring>
+
+bool MemoryPanel::create(bool use_planner) {
+    display = lv_display_create(WIDTH, HEIGHT);
+    if (!display) return false;
+
+    buf1.assign(WIDTH * BUFFER_LINES, 0);
+    buf2.assign(WIDTH * BUFFER_LINES, 0);
+    framebuffer.assign(WIDTH * HEIGHT, 0);
+    lv_display_set_flush_cb(display, flush_cb);
+    lv_display_set_buffers(display, buf1.data(), buf2.data(), buf1.size() * sizeof(uint16_t),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_user_data(display, this);
+
+    // Modèle de coût du mode partiel de DisplayDriver::configure_lvgl
+    plan_areas = use_planner;
+    DirtyPlanner::CostModel model;
+    model.flush_overhead_px = 6144;
+    model.align_px = 32;
+    model.max_areas = 8;
+    planner.configure(WIDTH, HEIGHT, model);
+    lv_display_add_event_cb(display, refr_start_cb, LV_EVENT_REFR_START, this);
+    return true;
+}
+
+void MemoryPanel::flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* color_map) {
+    MemoryPanel* self = static_cast<MemoryPanel*>(lv_display_get_user_data(disp));
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    const uint16_t* src = reinterpret_cast<const uint16_t*>(color_map);
+    for (int32_t y = 0; y < h; y++) {
+        memcpy(&self->framebuffer[(size_t)(area->y1 + y) * WIDTH + area->x1], src + (size_t)y * w,
+               w * sizeof(uint16_t));
+    }
+    self->counters.flushes++;
+    self->counters.bytes += (uint64_t)w * h * sizeof(uint16_t);
+    self->counters.flushed_px += (uint64_t)w * h;
+    if (lv_display_flush_is_last(disp)) self->counters.refreshes++;
+    lv_display_flush_ready(disp);
+}
+
+void MemoryPanel::refr_start_cb(lv_event_t* e) {
+    // Même planification que DisplayDriver::lvgl_refr_start_cb
+    MemoryPanel* self = static_cast<MemoryPanel*>(lv_event_get_user_data(e));
+    DirtyPlanner::Result result;
+    plan_display_areas(self->display, self->plan_areas ? &self->planner : nullptr, result);
+    self->counters.areas_in += result.areas_in;
+    self->counters.areas_out += result.areas_out;
+}
+
+MemoryPanel::Counters MemoryPanel::take_counters() {
+    Counters result = counters;
+    counters = {};
+    return result;
+}
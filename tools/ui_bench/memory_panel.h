@@ -0,0 +1,46 @@
+#pragma once
+
+#include "lvgl.h"
+#include "dirty_planner.h"
+#include <stdint.h>
+#include <vector>
+
+// Affichage LVGL en mémoire, configuré comme DisplayDriver en mode PARTIAL :
+// deux tampons de 60 lignes, mêmes événements de mesure et même planification
+// des zones invalidées. Le « panneau » ne fait que compter les octets reçus et
+// les recopier dans une image RGB565 pour l'export PNG.
+class MemoryPanel {
+public:
+    // Identiques à display_driver.h (pas d'en-tête ESP-IDF sur l'hôte)
+    static constexpr int32_t WIDTH = 1024;
+    static constexpr int32_t HEIGHT = 600;
+    static constexpr int32_t BUFFER_LINES = 60;
+
+    // Depuis le dernier relevé (remis à zéro)
+    struct Counters {
+        uint32_t flushes;
+        uint64_t bytes;
+        uint64_t flushed_px;
+        uint32_t refreshes;
+        uint32_t areas_in;          // Zones invalidées avant / après planification
+        uint32_t areas_out;
+    };
+
+private:
+    lv_display_t* display = nullptr;
+    std::vector<uint16_t> buf1;
+    std::vector<uint16_t> buf2;
+    std::vector<uint16_t> framebuffer;
+    DirtyPlanner planner;
+    bool plan_areas = true;
+    Counters counters = {};
+
+    static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* color_map);
+    static void refr_start_cb(lv_event_t* e);
+
+public:
+    bool create(bool use_planner);
+    lv_display_t* get_display() const { return display; }
+    const uint16_t* get_framebuffer() const { return framebuffer.data(); }
+    Counters take_counters();
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+// PNG RGB 8 bits sans compression (blocs deflate « stockés ») : aucune
+// dépendance, fichiers comparables octet à octet entre deux exécutions
+bool write_png_rgb565(const char* path, const uint16_t* pixels, int width, int height);
@@ -0,0 +1,292 @@
+// Banc de rendu hôte : le vrai LVGL, UIManager et GameEngine du firmware sur
+// un affichage en mémoire (MemoryPanel, configuration PARTIAL du pilote).
+// Chaque scénario pilote l'interface image par image sur une horloge
+// virtuelle de 33 ms et rapporte le temps de rendu, la surface transmise au
+// panneau et le pic du tas LVGL ; la dernière image est exportée en PNG.
+
+#include "lvgl.h"
+#include "memory_panel.h"
+#include "png_writer.h"
+#include "rgb565_kernels.h"
+#include "game_engine.h"
+#include "ui_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+int64_t bench_clock_us = 0;
+
+static constexpr uint32_t FRAME_US = 33333;
+static constexpr uint32_t GAME_EVERY = 3;          // Moteur à 10 Hz comme game_update_task
+
+struct Options {
+    const char* scenario = nullptr;
+    const char* frames_dir = nullptr;
+    const char* isa = nullptr;
+    bool plan = true;
+    bool list = false;
+};
+
+// Doigt simulé, lu par LVGL à chaque image (indev en mode minuterie)
+struct ScriptedPointer {
+    bool pressed = false;
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+struct BenchContext {
+    GameEngine* engine;
+    UIManager* ui;
+    MemoryPanel* panel;
+    ScriptedPointer pointer;
+};
+
+struct Scenario {
+    const char* name;
+    const char* description;
+    uint32_t frames;
+    void (*setup)(BenchContext& ctx);
+    void (*step)(BenchContext& ctx, uint32_t frame);
+    void (*teardown)(BenchContext& ctx);
+};
+
+static void pointer_read_cb(lv_indev_t* indev, lv_indev_data_t* data) {
+    const ScriptedPointer* pointer = static_cast<const ScriptedPointer*>(lv_indev_get_user_data(indev));
+    data->state = pointer->pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->point.x = pointer->x;
+    data->point.y = pointer->y;
+}
+
+static uint32_t tick_cb() {
+    return (uint32_t)(bench_clock_us / 1000);
+}
+
+// ---------------------------------------------------------------------------
+// Scénarios
+
+static void show_main(BenchContext& ctx) {
+    ctx.ui->switch_to_screen(SCREEN_MAIN);
+}
+
+static void setup_lvgl_shadows(BenchContext& ctx) {
+    ctx.ui->set_card_layers(false);
+    ctx.ui->switch_to_screen(SCREEN_MAIN);
+    lv_obj_invalidate(lv_screen_active());
+}
+
+static void restore_card_layers(BenchContext& ctx) {
+    ctx.ui->set_card_layers(true);
+}
+
+static void step_navigation(BenchContext& ctx, uint32_t frame) {
+    if (frame % 20 == 0) ctx.ui->switch_to_screen((uint8_t)((frame / 20) % (SCREEN_SETTINGS + 1)));
+}
+
+static void setup_list(BenchContext& ctx) {
+    // Population d'un grand élevage : la fenêtre virtuelle ne crée que les lignes visibles
+    for (uint32_t i = (uint32_t)ctx.engine->get_reptile_count(); i < 200; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "R%03u", (unsigned)i);
+        ctx.engine->add_reptile(static_cast<ReptileSpecies>(i % REPTILE_SPECIES_COUNT), name);
+    }
+    ctx.ui->switch_to_screen(SCREEN_REPTILE_SELECT);
+}
+
+static void step_list(BenchContext& ctx, uint32_t frame) {
+    // Glissé vertical de 350 px en 10 images, puis 20 images d'inertie
+    uint32_t phase = frame % 30;
+    ctx.pointer.x = MemoryPanel::WIDTH / 2;
+    ctx.pointer.pressed = phase < 10;
+    if (phase < 10) ctx.pointer.y = 500 - (int32_t)phase * 35;
+}
+
+static void release_pointer(BenchContext& ctx) {
+    ctx.pointer.pressed = false;
+}
+
+static void show_stats(BenchContext& ctx) {
+    ctx.ui->switch_to_screen(SCREEN_STATS);
+}
+
+static const Scenario scenarios[] = {
+    {"accueil", "écran principal au repos, modèle à 10 Hz", 300, show_main, nullptr, nullptr},
+    {"accueil-ombres-lvgl", "écran principal, ombres rendues par LVGL (cache de couches coupé)", 300,
+     setup_lvgl_shadows, nullptr, restore_card_layers},
+    {"navigation", "tous les écrans tour à tour, un changement toutes les 20 images", 280, show_main,
+     step_navigation, nullptr},
+    {"liste", "liste de 200 reptiles, glissés successifs", 300, setup_list, step_list, release_pointer},
+    {"graphique", "graphique des constantes, échantillons à 1 Hz", 300, show_stats, nullptr, nullptr},
+};
+
+// ---------------------------------------------------------------------------
+// Exécution
+
+struct Report {
+    std::vector<uint32_t> render_us;
+    MemoryPanel::Counters totals = {};
+    size_t mem_max_used = 0;
+};
+
+static uint32_t percentile(std::vector<uint32_t> values, uint32_t pct) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[(values.size() - 1) * pct / 100];
+}
+
+static Report run_scenario(BenchContext& ctx, const Scenario& scenario) {
+    Report report;
+    if (scenario.setup) scenario.setup(ctx);
+    // Construction de l'écran hors mesure : seul le régime établi est rapporté
+    lv_timer_handler();
+    ctx.panel->take_counters();
+
+    for (uint32_t frame = 0; frame < scenario.frames; frame++) {
+        bench_clock_us += FRAME_US;
+        if (scenario.step) scenario.step(ctx, frame);
+        if (frame % GAME_EVERY == 0) ctx.engine->update(GAME_EVERY * FRAME_US / 1000);
+        ctx.ui->update();
+
+        auto start = std::chrono::steady_clock::now();
+        lv_timer_handler();
+        auto end = std::chrono::steady_clock::now();
+        report.render_us.push_back(
+            (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        MemoryPanel::Counters frame_counters = ctx.panel->take_counters();
+        report.totals.flushes += frame_counters.flushes;
+        report.totals.bytes += frame_counters.bytes;
+        report.totals.flushed_px += frame_counters.flushed_px;
+        report.totals.refreshes += frame_counters.refreshes;
+        report.totals.areas_in += frame_counters.areas_in;
+        report.totals.areas_out += frame_counters.areas_out;
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        report.mem_max_used = std::max(report.mem_max_used, mon.max_used);
+    }
+    if (scenario.teardown) scenario.teardown(ctx);
+    return report;
+}
+
+static void print_report(const Scenario& scenario, const Report& report, const char* png) {
+    uint64_t sum = 0;
+    for (uint32_t us : report.render_us) sum += us;
+    size_t frames = report.render_us.size();
+    uint32_t refreshes = report.totals.refreshes ? report.totals.refreshes : 1;
+    printf("%s (%s)\n", scenario.name, scenario.description);
+    printf("  %zu images, %u rendues ; lv_timer_handler %llu us/image (p50 %u us, p95 %u us, max %u us)\n",
+           frames, (unsigned)report.totals.refreshes, (unsigned long long)(frames ? sum / frames : 0),
+           (unsigned)percentile(report.render_us, 50), (unsigned)percentile(report.render_us, 95),
+           (unsigned)percentile(report.render_us, 100));
+    printf("  par image rendue: %.1f -> %.1f zones, %u flushs, %llu px (%.1f %% de l'écran), %llu octets\n",
+           report.totals.areas_in / (double)refreshes, report.totals.areas_out / (double)refreshes,
+           (unsigned)(report.totals.flushes / refreshes),
+           (unsigned long long)(report.totals.flushed_px / refreshes),
+           100.0 * report.totals.flushed_px / refreshes / (MemoryPanel::WIDTH * MemoryPanel::HEIGHT),
+           (unsigned long long)(report.totals.bytes / refreshes));
+    printf("  tas LVGL: pic %zu octets\n", report.mem_max_used);
+    if (png) printf("  image: %s\n", png);
+}
+
+static void usage() {
+    fprintf(stderr,
+            "usage: ui_bench [--scenario <nom>] [--frames <dossier>] [--no-plan] [--isa <jeu>] [--list]\n"
+            "  --frames   exporte la dernière image de chaque scénario en PNG\n"
+            "  --no-plan  zones invalidées de LVGL sans planification (comparaison)\n"
+            "  --isa      noyaux RGB565 : générique (boucles de LVGL), sse2 ou avx2\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--scenario") && i + 1 < argc) options.scenario = argv[++i];
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc) options.frames_dir = argv[++i];
+        else if (!strcmp(argv[i], "--no-plan")) options.plan = false;
+        else if (!strcmp(argv[i], "--isa") && i + 1 < argc) options.isa = argv[++i];
+        else if (!strcmp(argv[i], "--list")) options.list = true;
+        else {
+            usage();
+            return 2;
+        }
+    }
+    if (options.list) {
+        for (const Scenario& scenario : scenarios) printf("%-20s %s\n", scenario.name, scenario.description);
+        return 0;
+    }
+
+    if (options.isa) {
+        const rgb565_isa_t levels[] = {RGB565_ISA_NONE, RGB565_ISA_SSE2, RGB565_ISA_AVX2};
+        bool known = false;
+        for (rgb565_isa_t isa : levels) {
+            if (strcmp(options.isa, rgb565_isa_name(isa))) continue;
+            rgb565_force_isa(isa);
+            known = rgb565_get_isa() == isa;
+        }
+        if (!known) {
+            fprintf(stderr, "jeu d'instructions indisponible: %s\n", options.isa);
+            return 2;
+        }
+    }
+
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    MemoryPanel panel;
+    if (!panel.create(options.plan)) {
+        fprintf(stderr, "affichage LVGL impossible\n");
+        return 1;
+    }
+
+    BenchContext ctx = {};
+    ctx.panel = &panel;
+    lv_indev_t* indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, pointer_read_cb);
+    lv_indev_set_user_data(indev, &ctx.pointer);
+    lv_indev_set_display(indev, panel.get_display());
+
+    // Mêmes reptiles que create_default_reptiles() (main.cpp)
+    GameEngine engine;
+    engine.add_reptile(ReptileSpecies::POGONA_VITTICEPS, "Sunny");
+    engine.add_reptile(ReptileSpecies::LEOPARD_GECKO, "Luna");
+    engine.add_reptile(ReptileSpecies::BALL_PYTHON, "Orion");
+    UIManager ui(&engine);
+    if (!ui.initialize()) {
+        fprintf(stderr, "initialisation de l'interface impossible\n");
+        return 1;
+    }
+    ctx.engine = &engine;
+    ctx.ui = &ui;
+
+    printf("ui_bench: %dx%d, tampons de %d lignes, planification %s, noyaux %s, %d unités de dessin\n",
+           (int)MemoryPanel::WIDTH, (int)MemoryPanel::HEIGHT, (int)MemoryPanel::BUFFER_LINES,
+           options.plan ? "active" : "coupée", rgb565_isa_name(rgb565_get_isa()), (int)LV_DRAW_SW_DRAW_UNIT_CNT);
+
+    int status = 0;
+    bool found = false;
+    for (const Scenario& scenario : scenarios) {
+        if (options.scenario && strcmp(options.scenario, scenario.name)) continue;
+        found = true;
+        Report report = run_scenario(ctx, scenario);
+
+        std::string png;
+        if (options.frames_dir) {
+            png = std::string(options.frames_dir) + "/" + scenario.name + ".png";
+            if (!write_png_rgb565(png.c_str(), panel.get_framebuffer(), MemoryPanel::WIDTH, MemoryPanel::HEIGHT)) {
+                fprintf(stderr, "écriture de %s impossible\n", png.c_str());
+                status = 1;
+                png.clear();
+            }
+        }
+        print_report(scenario, report, png.empty() ? nullptr : png.c_str());
+    }
+    if (!found) {
+        fprintf(stderr, "scénario inconnu: %s\n", options.scenario);
+        return 2;
+    }
+    return status;
+}